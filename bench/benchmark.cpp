@@ -0,0 +1,212 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <Eigen/Dense>
+
+#include "one_dim.h"
+#include "multi_dim.h"
+#include "common.h"
+#include "numerics.h"
+#include "solver_session.h"
+#include "stochastic.h"
+#include "objective.h"
+
+#define BENCH_REPEATS 50
+#define BENCH_DATASET "mo_bench_dataset.mocd"
+#define BENCH_DATASET_ROWS 200000
+
+template <typename Scalar>
+Scalar rosenbrock(const vector_t<Scalar>& x)
+{
+    Scalar result = 0;
+    for (int i = 0; i + 1 < x.size(); ++i) {
+        result += (1 - x[i]) * (1 - x[i]) + 10 * (x[i + 1] - x[i] * x[i]) * (x[i + 1] - x[i] * x[i]);
+    }
+    return result; //[1, ..., 1]
+}
+
+// rosenbrock with its analytic gradient, for the fused solvers.
+struct rosenbrock_objective {
+    double value(const Eigen::VectorXd& x) const {
+        return rosenbrock(x);
+    }
+
+    double value_and_gradient(const Eigen::VectorXd& x, Eigen::VectorXd& grad) const {
+        grad = Eigen::VectorXd::Zero(x.size());
+        for (int i = 0; i + 1 < x.size(); ++i) {
+            grad[i] += -2 * (1 - x[i]) - 40 * x[i] * (x[i + 1] - x[i] * x[i]);
+            grad[i + 1] += 20 * (x[i + 1] - x[i] * x[i]);
+        }
+        return rosenbrock(x);
+    }
+};
+
+// Same, with the exact Hessian applied to a vector.
+struct rosenbrock_hvp_objective : rosenbrock_objective {
+    Eigen::VectorXd hessian_vector_product(const Eigen::VectorXd& x, const Eigen::VectorXd& v) const {
+        Eigen::VectorXd product = Eigen::VectorXd::Zero(x.size());
+        for (int i = 0; i + 1 < x.size(); ++i) {
+            product[i] += (2 - 40 * x[i + 1] + 120 * x[i] * x[i]) * v[i] - 40 * x[i] * v[i + 1];
+            product[i + 1] += -40 * x[i] * v[i] + 20 * v[i + 1];
+        }
+        return product;
+    }
+};
+
+double quadratic(const Eigen::VectorXd& x)
+{
+    double result = 0;
+    for (int i = 0; i < x.size(); ++i) {
+        result += (i + 1) * (x[i] - 0.5 * i) * (x[i] - 0.5 * i) + 0.1 * x[i] * x[(i + 1) % x.size()];
+    }
+    return result;
+}
+
+double one_dim_func(const double x)
+{
+    return std::pow(x - 2.0, 4) + std::exp(0.2 * x); //1.84
+}
+
+// Runs solve BENCH_REPEATS times and prints the mean wall time with the statistic of the last run.
+template <typename Solve>
+void bench(const std::string& name, Solve solve, const int repeats=BENCH_REPEATS) {
+    auto statistic = solve();
+    auto begin = std::chrono::steady_clock::now();
+    for (int repeat = 1; repeat < repeats; ++repeat) {
+        statistic = solve();
+    }
+    auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << name << ": " << elapsed / (repeats - 1) << " us per solve; " << statistic;
+}
+
+void bench_one_dim() {
+    std::function<double(double)> function = one_dim_func;
+
+    bench("1-D golden ratio", [&]() { return golden_ratio(function, -10.0, 10.0); });
+    bench("1-D fibonacchi", [&]() { return fibonacchi(function, -10.0, 10.0); });
+    bench("1-D bracket + brent", [&]() {
+        double left, right;
+        bracket(function, left, right, -10.0);
+        return brent(function, left, right);
+    });
+}
+
+void bench_multi_dim(const uint32_t dimension) {
+    std::function<double(const Eigen::VectorXd&)> function_nd = rosenbrock<double>;
+    std::function<float(const vector_t<float>&)> function_nd_float = rosenbrock<float>;
+
+    Eigen::VectorXd start = Eigen::VectorXd::Constant(dimension, -0.5);
+    Eigen::VectorXd lower = Eigen::VectorXd::Constant(dimension, -2.0);
+    Eigen::VectorXd upper = Eigen::VectorXd::Constant(dimension, 0.8);
+    std::string suffix = " (rosenbrock, n = " + std::to_string(dimension) + ")";
+
+    bench("Gradient descend" + suffix, [&]() { return gradient_descend(function_nd, start, N_DIM_ACCURACY, N_DIM_ITERS_MAX, ND_BRENT); });
+    bench("Conjugate gradient descend" + suffix, [&]() { return conj_gradient_descend(function_nd, start, N_DIM_ACCURACY, N_DIM_ITERS_MAX, ND_BRENT); });
+    bench("Newtone Raphson" + suffix, [&]() { return newtone_raphson(function_nd, start); });
+    bench("Mixed precision Newtone Raphson" + suffix, [&]() { return mixed_precision<float>(function_nd_float, function_nd, start, NEWTONE_RAPHSON); });
+    bench("Projected gradient descend" + suffix, [&]() { return projected_gradient_descend(function_nd, start, lower, upper, N_DIM_ACCURACY, N_DIM_ITERS_MAX, ND_BRENT); });
+    bench("Projected Newtone Raphson" + suffix, [&]() { return projected_newtone_raphson(function_nd, start, lower, upper); });
+    bench("Quasi Newton" + suffix, [&]() { return solver_session(start).quasi_newton(function_nd); });
+}
+
+void bench_fused(const uint32_t dimension) {
+    rosenbrock_objective objective;
+    rosenbrock_hvp_objective objective_hvp;
+
+    Eigen::VectorXd start = Eigen::VectorXd::Constant(dimension, -0.5);
+    std::string suffix = " (fused rosenbrock, n = " + std::to_string(dimension) + ")";
+
+    bench("Gradient descend" + suffix, [&]() { return gradient_descend(objective, start); });
+    bench("Conjugate gradient descend" + suffix, [&]() { return conj_gradient_descend(objective, start); });
+    bench("Newtone Raphson" + suffix, [&]() { return newtone_raphson(objective, start); });
+    bench("Newtone Raphson with Hessian vector products" + suffix, [&]() { return newtone_raphson(objective_hvp, start); });
+}
+
+void bench_session(const uint32_t dimension) {
+    Eigen::VectorXd start = Eigen::VectorXd::Zero(dimension);
+    std::string suffix = " (sweep, n = " + std::to_string(dimension) + ")";
+
+    auto sweep = [&](std::function<search_result_nd(const std::function<double(const Eigen::VectorXd&)>&)> solve) {
+        search_result_nd total;
+        for (double shift = 0.0; shift < 1.0; shift += 0.05) {
+            auto statistic = solve([shift](const Eigen::VectorXd& x) { return quadratic(x) + shift * x.sum() + 0.01 * x.squaredNorm() * x.squaredNorm(); });
+            total.type = statistic.type;
+            total.result = statistic.result;
+            total.accuracy = statistic.accuracy;
+            total.iterations += statistic.iterations;
+            total.function_probes += statistic.function_probes;
+        }
+        return total;
+    };
+
+    bench("Cold Newtone Raphson" + suffix, [&]() { 
+        return sweep([&](const std::function<double(const Eigen::VectorXd&)>& function_nd) { return newtone_raphson(function_nd, start); }); 
+    });
+    bench("Session Newtone Raphson" + suffix, [&]() { 
+        solver_session session(start);
+        return sweep([&](const std::function<double(const Eigen::VectorXd&)>& function_nd) { return session.newtone_raphson(function_nd); }); 
+    });
+    bench("Session quasi Newton" + suffix, [&]() { 
+        solver_session session(start);
+        return sweep([&](const std::function<double(const Eigen::VectorXd&)>& function_nd) { return session.quasi_newton(function_nd); }); 
+    });
+}
+
+double regression_term(const Eigen::VectorXd& x, const record_t<double>& record)
+{
+    double error = x[0] * record[0] + x[1] * record[1] + x[2] * record[2] - record[3];
+    return 0.5 * error * error; //[1.5, -2, 0.5]
+}
+
+void regression_term_gradient(const Eigen::VectorXd& x, const record_t<double>& record, Eigen::VectorXd& grad)
+{
+    double error = x[0] * record[0] + x[1] * record[1] + x[2] * record[2] - record[3];
+    for (int i = 0; i < 3; ++i) {
+        grad[i] += error * record[i];
+    }
+}
+
+void bench_stochastic() {
+    std::mt19937_64 random(STOCHASTIC_SEED);
+    std::normal_distribution<double> normal;
+
+    Eigen::MatrixXd records(BENCH_DATASET_ROWS, 4);
+    for (int row = 0; row < records.rows(); ++row) {
+        records(row, 0) = normal(random);
+        records(row, 1) = normal(random);
+        records(row, 2) = normal(random);
+        records(row, 3) = 1.5 * records(row, 0) - 2.0 * records(row, 1) + 0.5 * records(row, 2) + 0.1 * normal(random);
+    }
+    mapped_dataset::write(BENCH_DATASET, records);
+
+    {
+        mapped_dataset dataset(BENCH_DATASET);
+        sum_objective objective(dataset, regression_term);
+        sum_objective objective_grad(dataset, regression_term, regression_term_gradient);
+
+        Eigen::VectorXd start = Eigen::VectorXd::Zero(3);
+        std::string suffix = " (regression, rows = " + std::to_string(BENCH_DATASET_ROWS) + ")";
+
+        bench("SGD with momentum" + suffix, [&]() { return sgd_momentum(objective, start, 1e-2, SGD_MOMENTUM_FACTOR, STOCHASTIC_BATCH_SIZE, 2); }, 5);
+        bench("Adam" + suffix, [&]() { return adam(objective_grad, start, 1e-2); }, 5);
+        bench("SVRG" + suffix, [&]() { return svrg(objective_grad, start, 1e-1); }, 5);
+    }
+
+    std::remove(BENCH_DATASET);
+}
+
+int main() {
+    bench_one_dim();
+    bench_multi_dim(2);
+    bench_multi_dim(8);
+    bench_fused(8);
+    bench_session(8);
+    bench_stochastic();
+
+    return 0;
+}
@@ -0,0 +1,31 @@
+include(CMakePackageConfigHelpers)
+
+set(MO_OPTIM_CMAKE_DIR ${CMAKE_INSTALL_LIBDIR}/cmake/mo_optim)
+
+install(TARGETS mo_optim EXPORT mo_optimTargets
+    ARCHIVE DESTINATION ${CMAKE_INSTALL_LIBDIR}
+    LIBRARY DESTINATION ${CMAKE_INSTALL_LIBDIR}
+    RUNTIME DESTINATION ${CMAKE_INSTALL_BINDIR}
+)
+
+install(DIRECTORY ${PROJECT_SOURCE_DIR}/include/ DESTINATION ${CMAKE_INSTALL_INCLUDEDIR}/mo_optim)
+
+install(EXPORT mo_optimTargets NAMESPACE mo_optim:: DESTINATION ${MO_OPTIM_CMAKE_DIR})
+
+configure_package_config_file(
+    ${PROJECT_SOURCE_DIR}/cmake/mo_optimConfig.cmake.in
+    ${PROJECT_BINARY_DIR}/mo_optimConfig.cmake
+    INSTALL_DESTINATION ${MO_OPTIM_CMAKE_DIR}
+)
+
+write_basic_package_version_file(
+    ${PROJECT_BINARY_DIR}/mo_optimConfigVersion.cmake
+    VERSION ${PROJECT_VERSION}
+    COMPATIBILITY SameMajorVersion
+)
+
+install(FILES 
+    ${PROJECT_BINARY_DIR}/mo_optimConfig.cmake 
+    ${PROJECT_BINARY_DIR}/mo_optimConfigVersion.cmake 
+    DESTINATION ${MO_OPTIM_CMAKE_DIR}
+)
@@ -0,0 +1,77 @@
+# Optimization modes shared by mo_optim and the executables built with it.
+#
+# Profile guided optimization workflow (GCC or Clang):
+#   cmake -S . -B build -DMO_OPTIM_PGO=GENERATE && cmake --build build --target pgo_train
+#   cmake -S . -B build -DMO_OPTIM_PGO=USE && cmake --build build
+# pgo_train runs mo_bench, so the profile reflects the benchmark suite.
+
+if(MO_OPTIM_LTO)
+    include(CheckIPOSupported)
+    check_ipo_supported(RESULT MO_OPTIM_LTO_SUPPORTED OUTPUT MO_OPTIM_LTO_ERROR LANGUAGES CXX)
+    if(NOT MO_OPTIM_LTO_SUPPORTED)
+        message(WARNING "Link time optimization is not supported: ${MO_OPTIM_LTO_ERROR}")
+    endif()
+endif()
+
+if(MO_OPTIM_NATIVE)
+    include(CheckCXXCompilerFlag)
+    check_cxx_compiler_flag("-march=native" MO_OPTIM_NATIVE_SUPPORTED)
+    if(NOT MO_OPTIM_NATIVE_SUPPORTED)
+        message(WARNING "-march=native is not supported by ${CMAKE_CXX_COMPILER_ID}")
+    endif()
+endif()
+
+string(TOUPPER "${MO_OPTIM_PGO}" MO_OPTIM_PGO)
+if(NOT MO_OPTIM_PGO MATCHES "^(OFF|GENERATE|USE)$")
+    message(FATAL_ERROR "MO_OPTIM_PGO must be OFF, GENERATE or USE, got ${MO_OPTIM_PGO}")
+endif()
+
+if(NOT MO_OPTIM_PGO STREQUAL "OFF" AND NOT CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+    message(FATAL_ERROR "Profile guided optimization is only wired up for GCC and Clang")
+endif()
+
+if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    # Clang reads a single merged profile, produced by pgo_train through llvm-profdata.
+    set(MO_OPTIM_PGO_PROFILE "${MO_OPTIM_PGO_DIR}/mo_optim.profdata")
+else()
+    set(MO_OPTIM_PGO_PROFILE "${MO_OPTIM_PGO_DIR}")
+endif()
+
+if(MO_OPTIM_PGO STREQUAL "USE" AND NOT EXISTS "${MO_OPTIM_PGO_PROFILE}")
+    message(WARNING "No profile found at ${MO_OPTIM_PGO_PROFILE}; run the GENERATE stage and pgo_train first")
+endif()
+
+# Applies the selected optimization modes to a target that has sources of its own.
+function(mo_optim_optimize target)
+    get_target_property(type ${target} TYPE)
+
+    if(MO_OPTIM_LTO AND MO_OPTIM_LTO_SUPPORTED)
+        set_property(TARGET ${target} PROPERTY INTERPROCEDURAL_OPTIMIZATION ON)
+
+        if(type STREQUAL "STATIC_LIBRARY" AND CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+            # Keep machine code next to the LTO bytecode, so consumers linking without LTO still work.
+            target_compile_options(${target} PRIVATE -ffat-lto-objects)
+        endif()
+    endif()
+
+    if(MO_OPTIM_NATIVE AND MO_OPTIM_NATIVE_SUPPORTED)
+        # Eigen's alignment, and so its allocation ABI, follows -march: Eigen objects cross the
+        # library boundary, so consumers of a library must be built with the same flag.
+        if(type MATCHES "LIBRARY")
+            target_compile_options(${target} PUBLIC -march=native)
+        else()
+            target_compile_options(${target} PRIVATE -march=native)
+        endif()
+    endif()
+
+    if(MO_OPTIM_PGO STREQUAL "GENERATE")
+        target_compile_options(${target} PRIVATE -fprofile-generate=${MO_OPTIM_PGO_DIR} -fprofile-update=atomic)
+        target_link_libraries(${target} PRIVATE -fprofile-generate=${MO_OPTIM_PGO_DIR})
+    elseif(MO_OPTIM_PGO STREQUAL "USE")
+        target_compile_options(${target} PRIVATE -fprofile-use=${MO_OPTIM_PGO_PROFILE})
+        if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+            target_compile_options(${target} PRIVATE -fprofile-correction -Wno-missing-profile)
+        endif()
+        target_link_libraries(${target} PRIVATE -fprofile-use=${MO_OPTIM_PGO_PROFILE})
+    endif()
+endfunction()
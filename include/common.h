@@ -8,4 +8,36 @@
 #define DX                      1e-6
 #define PER_COORD_DESCEND_STEP  2.0
 #define ACCURACY                1e-6
-#define ITERS_MAX               50
\ No newline at end of file
+#define ITERS_MAX               50
+#define BRACKET_STEP            1.0
+#define BRACKET_GROW_LIMIT      100.0
+#define BRENT_TINY              1e-20
+#define SESSION_HISTORY         8
+#define SESSION_DRIFT_TOLERANCE 0.1
+#define NEWTON_REUSE_RATIO      0.5
+#define STOCHASTIC_BATCH_SIZE   1024
+#define STOCHASTIC_EPOCHS       10
+#define STOCHASTIC_MIN_CHUNK    4096
+#define STOCHASTIC_SEED         42
+#define SGD_LEARNING_RATE       1e-2
+#define SGD_MOMENTUM_FACTOR     0.9
+#define ADAM_LEARNING_RATE      1e-3
+#define ADAM_BETA_1             0.9
+#define ADAM_BETA_2             0.999
+#define ADAM_EPSILON            1e-8
+#define ARMIJO_SLOPE            1e-4
+#define WOLFE_CURVATURE         0.1
+#define SECANT_STEPS            3
+
+// Scalar types every solver is explicitly instantiated for.
+#define INSTANTIATE_FOR_SCALARS(MACRO) MACRO(float) MACRO(double) MACRO(long double)
+
+// Keeps a parameter out of template argument deduction, so plain functions and lambdas
+// still convert to std::function while the scalar type is deduced from the other arguments.
+template <typename T>
+struct non_deduced {
+    using type = T;
+};
+
+template <typename T>
+using non_deduced_t = typename non_deduced<T>::type;
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "common.h"
+#include "numerics.h"
+
+// On-disk layout of a record file: this header, then every column stored contiguously (rows values each).
+struct dataset_header {
+    char magic[4];
+    uint32_t scalar_size;
+    uint64_t rows;
+    uint64_t cols;
+    uint64_t reserved;
+};
+
+#define DATASET_MAGIC "MOCD"
+
+// Read-only, memory-mapped, column-oriented record file.
+template <typename Scalar>
+class mapped_dataset_t {
+public:
+    explicit mapped_dataset_t(const std::string& path);
+    ~mapped_dataset_t();
+
+    mapped_dataset_t(const mapped_dataset_t&) = delete;
+    mapped_dataset_t& operator=(const mapped_dataset_t&) = delete;
+
+    uint64_t rows() const { return header->rows; }
+    uint64_t cols() const { return header->cols; }
+    const Scalar* column(const uint64_t index) const { return data + index * header->rows; }
+
+    // Asks the OS to start paging in rows [begin, end) of every column; does not wait, except before Windows 8.
+    void prefetch(const uint64_t begin, const uint64_t end) const;
+
+    // Writes records (one row per record, one column per field) in the layout read above.
+    static void write(const std::string& path, const matrix_t<Scalar>& records);
+
+private:
+    void unmap();
+
+    void* mapping;
+    uint64_t mapping_size;
+    const dataset_header* header;
+    const Scalar* data;
+
+    #ifdef _WIN32
+        void* file_handle;
+        void* mapping_handle;
+    #endif
+};
+
+// One record of a mapped dataset; field values are read straight from the mapping.
+template <typename Scalar>
+struct record_t {
+    const mapped_dataset_t<Scalar>* dataset;
+    uint64_t row;
+
+    Scalar operator[](const uint64_t field) const { return dataset->column(field)[row]; }
+};
+
+using mapped_dataset = mapped_dataset_t<double>;
+
+#ifdef MO_OPTIM_HEADER_ONLY
+#include "impl/dataset.ipp"
+#endif
@@ -0,0 +1,151 @@
+#pragma once
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+    // Included into every consumer in header-only mode: keep min/max and the rarely used APIs out.
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "common.h"
+#include "dataset.h"
+
+template <typename Scalar>
+mapped_dataset_t<Scalar>::mapped_dataset_t(const std::string& path) {
+    #ifdef _WIN32
+        file_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_handle == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Cannot open dataset " + path);
+        }
+
+        LARGE_INTEGER size;
+        GetFileSizeEx(file_handle, &size);
+        mapping_size = size.QuadPart;
+
+        mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        mapping = mapping_handle ? MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (mapping == nullptr) {
+            if (mapping_handle) {
+                CloseHandle(mapping_handle);
+            }
+            CloseHandle(file_handle);
+            throw std::runtime_error("Cannot map dataset " + path);
+        }
+    #else
+        int file = open(path.c_str(), O_RDONLY);
+        if (file < 0) {
+            throw std::runtime_error("Cannot open dataset " + path);
+        }
+
+        struct stat info;
+        fstat(file, &info);
+        mapping_size = info.st_size;
+
+        mapping = mapping_size ? mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, file, 0) : MAP_FAILED;
+        close(file);
+
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error("Cannot map dataset " + path);
+        }
+    #endif
+
+    header = static_cast<const dataset_header*>(mapping);
+    data = reinterpret_cast<const Scalar*>(header + 1);
+
+    const char* error = nullptr;
+    if (mapping_size < sizeof(dataset_header) || std::memcmp(header->magic, DATASET_MAGIC, sizeof(header->magic)) != 0) {
+        error = "Not a dataset file: ";
+    } else if (header->scalar_size != sizeof(Scalar)) {
+        error = "Dataset scalar type does not match: ";
+    } else if (header->cols != 0 && header->rows > (mapping_size - sizeof(dataset_header)) / sizeof(Scalar) / header->cols) {
+        // Checked by division first, so a corrupted header cannot overflow the product below.
+        error = "Dataset size does not match its header: ";
+    } else if (mapping_size != sizeof(dataset_header) + header->rows * header->cols * sizeof(Scalar)) {
+        error = "Dataset size does not match its header: ";
+    }
+
+    if (error) {
+        unmap();
+        throw std::runtime_error(error + path);
+    }
+}
+
+template <typename Scalar>
+mapped_dataset_t<Scalar>::~mapped_dataset_t() {
+    unmap();
+}
+
+template <typename Scalar>
+void mapped_dataset_t<Scalar>::unmap() {
+    #ifdef _WIN32
+        UnmapViewOfFile(mapping);
+        CloseHandle(mapping_handle);
+        CloseHandle(file_handle);
+    #else
+        munmap(mapping, mapping_size);
+    #endif
+}
+
+template <typename Scalar>
+void mapped_dataset_t<Scalar>::prefetch(const uint64_t begin, const uint64_t end) const {
+    if (begin >= end) {
+        return;
+    }
+
+    for (uint64_t col = 0; col < cols(); ++col) {
+        const char* from = reinterpret_cast<const char*>(column(col) + begin);
+        const char* to = reinterpret_cast<const char*>(column(col) + end);
+
+        #if defined(_WIN32) && _WIN32_WINNT >= 0x0602
+            WIN32_MEMORY_RANGE_ENTRY range{const_cast<char*>(from), static_cast<SIZE_T>(to - from)};
+            PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+        #elif defined(_WIN32)
+            // No advice call before Windows 8: touching one byte per page pulls it in, synchronously.
+            volatile char sink;
+            for (const char* page = from; page < to; page += 4096) {
+                sink = *page;
+            }
+            sink = *(to - 1);
+            (void)sink;
+        #else
+            static const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+            uintptr_t aligned = reinterpret_cast<uintptr_t>(from) & ~(page_size - 1);
+            madvise(reinterpret_cast<void*>(aligned), reinterpret_cast<uintptr_t>(to) - aligned, MADV_WILLNEED);
+        #endif
+    }
+}
+
+template <typename Scalar>
+void mapped_dataset_t<Scalar>::write(const std::string& path, const matrix_t<Scalar>& records) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Cannot create dataset " + path);
+    }
+
+    dataset_header header = {};
+    std::memcpy(header.magic, DATASET_MAGIC, sizeof(header.magic));
+    header.scalar_size = sizeof(Scalar);
+    header.rows = records.rows();
+    header.cols = records.cols();
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    // matrix_t is column major, so its storage already is the column-oriented layout.
+    file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(Scalar));
+
+    if (!file) {
+        throw std::runtime_error("Cannot write dataset " + path);
+    }
+}
@@ -0,0 +1,701 @@
+#pragma once
+#include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
+
+#include "common.h"
+#include "one_dim.h"
+#include "multi_dim.h"
+#include "search_result_nd.h"
+#include "numerics.h"
+
+namespace mo_optim_detail {
+    // Searches the segment [from, to]; ND_BRENT instead brackets along the whole ray from -> to,
+    // unless within_segment asks to stay on the segment (e.g. when only the segment is feasible).
+    template <typename Scalar>
+    inline search_result_nd_t<Scalar> line_search(
+        const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+        const vector_t<Scalar>& from, 
+        const vector_t<Scalar>& to, 
+        const non_deduced_t<Scalar> eps, 
+        const search_method_type_nd line_search_type,
+        const bool within_segment = false
+    ) {
+        switch (line_search_type) {
+            case search_method_type_nd::ND_BISECT:
+                return bisect<Scalar>(function_nd, from, to, eps);
+            case search_method_type_nd::ND_GOLDEN_RATIO:
+                return golden_ratio<Scalar>(function_nd, from, to, eps);
+            case search_method_type_nd::ND_BRENT:
+                if (within_segment) {
+                    return brent<Scalar>(function_nd, from, to, eps);
+                }
+                break;
+            default:
+                return fibonacchi<Scalar>(function_nd, from, to, eps);
+        }
+
+        search_result_nd_t<Scalar> statistic;
+        statistic.type = search_method_type_nd::ND_BRENT;
+        statistic.result = from;
+
+        const vector_t<Scalar> ray = to - from;
+        const Scalar length = ray.norm();
+
+        if (length == 0.0) {
+            return statistic;
+        }
+
+        auto function = [&](Scalar t) { return function_nd(from + t * ray); };
+
+        Scalar left, right;
+        auto bracket_statistic = bracket<Scalar>(function, left, right, 0.0, BRACKET_STEP);
+
+        if (bracket_statistic.type == search_method_type::NONE) {
+            // The ray keeps descending: fall back to the segment search, capped at to.
+            statistic = fibonacchi<Scalar>(function_nd, from, to, eps);
+            statistic.iterations += bracket_statistic.iterations;
+            statistic.function_probes += bracket_statistic.function_probes;
+
+            return statistic;
+        }
+
+        auto sub_statistic = brent<Scalar>(function, left, right, eps / length);
+
+        statistic.result = from + sub_statistic.result * ray;
+        statistic.accuracy = sub_statistic.accuracy * length;
+        statistic.iterations = bracket_statistic.iterations + sub_statistic.iterations;
+        statistic.function_probes = bracket_statistic.function_probes + sub_statistic.function_probes;
+
+        return statistic;
+    }
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> bisect(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& left, 
+    const non_deduced_t<vector_t<Scalar>>& right, 
+    const non_deduced_t<Scalar> eps, 
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called multi dimensional bisect method with parameters:\nleft = " << left << ";\nright = " << right 
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::ND_BISECT;
+    
+    vector_t<Scalar> dir(left.size()), lhs(left), rhs(right);
+    
+    dir = direction(lhs, rhs) * (Scalar(0.1) * eps);
+
+    while (statistic.iterations != max_iterations && (statistic.accuracy = distance(lhs, rhs)) > 2.0 * eps) {
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations + 1 << ": left = " << lhs << "; right = " << rhs
+            << "; accuracy = " << statistic.accuracy << '\n';
+        #endif
+
+        statistic.result = (lhs + rhs) * Scalar(0.5);
+
+        vector_t<Scalar> x_l = statistic.result - dir;
+        vector_t<Scalar> x_r = statistic.result + dir;
+
+        if (function_nd(x_l) > function_nd(x_r)) {
+            lhs = x_l;
+        } else {
+            rhs = x_r;
+        }
+
+        ++statistic.iterations;
+    }
+
+    statistic.function_probes = 2 * statistic.iterations;
+    statistic.accuracy *= 0.5;
+
+    return statistic;
+}
+
+
+template <typename Scalar>
+search_result_nd_t<Scalar> golden_ratio(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& left, 
+    const non_deduced_t<vector_t<Scalar>>& right, 
+    const non_deduced_t<Scalar> eps, 
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called multi dimensional golden_ratio method with parameters:\nleft = " << left << ";\nright = " << right 
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::ND_GOLDEN_RATIO;
+
+    vector_t<Scalar> lhs(left), rhs(right);
+
+    vector_t<Scalar> x_r = lhs + Scalar(PSI) * (rhs - lhs);
+    vector_t<Scalar> x_l = rhs - Scalar(PSI) * (rhs - lhs);
+
+    Scalar y_r = function_nd(x_r);
+    Scalar y_l = function_nd(x_l);
+
+    while (statistic.iterations != max_iterations && (statistic.accuracy = distance(lhs, rhs)) > 2.0 * eps) {
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations + 1 << ": left = " << lhs << "; right = " << rhs
+            << "; accuracy = " << statistic.accuracy << '\n';
+        #endif
+
+        if (y_l > y_r) {
+            lhs = x_l;
+            x_l = x_r;
+            y_l = y_r;
+            x_r = lhs + Scalar(PSI) * (rhs - lhs);
+            y_r = function_nd(x_r);
+        } else {
+            rhs = x_r;
+            x_r = x_l;
+            y_r = y_l;
+            x_l = rhs - Scalar(PSI) * (rhs - lhs);
+            y_l = function_nd(x_l);
+        }
+
+        ++statistic.iterations;
+    }
+
+
+    statistic.function_probes = statistic.iterations + 2;
+    statistic.result = (lhs + rhs) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+
+    return statistic;
+}
+
+
+template <typename Scalar>
+search_result_nd_t<Scalar> fibonacchi(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& left, 
+    const non_deduced_t<vector_t<Scalar>>& right, 
+    const non_deduced_t<Scalar> eps
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called multi dimensional fibonacchi with parameters:\nleft = " << left << ";\nright = " << right 
+        << ";\neps =" << eps << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::ND_FIBONACCHI;
+
+    vector_t<Scalar> lhs(left), rhs(right);
+
+    uint64_t fib_1 = 1, fib_2 = 1;
+    Scalar threshold = distance(rhs, lhs) / eps;
+
+    while (fib_2 < threshold && fib_2 <= FIB_LIMIT) {
+        fib_next(fib_1, fib_2);
+        ++statistic.iterations;
+    }
+
+    vector_t<Scalar> x_r = lhs + Scalar(fib_1) / Scalar(fib_2) * (rhs - lhs);
+    vector_t<Scalar> x_l = lhs + Scalar(fib_2 - fib_1) / Scalar(fib_2) * (rhs - lhs);
+
+    Scalar y_r = function_nd(x_r);
+    Scalar y_l = function_nd(x_l);
+
+    for (uint64_t iterations = statistic.iterations; iterations > 0; --iterations) {
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations - iterations + 1 << ": left = " << lhs << "; right = " << rhs
+            << "; accuracy = " << statistic.accuracy << '\n';
+        #endif
+
+        fib_prev(fib_1, fib_2);
+
+        if (y_l > y_r) {
+            lhs = x_l;
+            x_l = x_r;
+            y_l = y_r;
+            x_r = lhs + Scalar(fib_1) / Scalar(fib_2) * (rhs - lhs);
+            y_r = function_nd(x_r);
+        } else {
+            rhs = x_r;
+            x_r = x_l;
+            y_r = y_l;
+            x_l = lhs + Scalar(fib_2 - fib_1) / Scalar(fib_2) * (rhs - lhs);
+            y_l = function_nd(x_l);
+        }
+    }
+
+    statistic.result = (lhs + rhs) * Scalar(0.5);
+    statistic.accuracy = distance(rhs, lhs) * 0.5;
+    statistic.function_probes = statistic.iterations + 2;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> brent(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& left, 
+    const non_deduced_t<vector_t<Scalar>>& right, 
+    const non_deduced_t<Scalar> eps, 
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called multi dimensional brent method with parameters:\nleft = " << left << ";\nright = " << right 
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::ND_BRENT;
+    statistic.result = left;
+
+    const vector_t<Scalar> segment = right - left;
+    const Scalar length = segment.norm();
+
+    if (length == 0.0) {
+        return statistic;
+    }
+
+    auto sub_statistic = brent<Scalar>([&](Scalar t) { return function_nd(left + t * segment); }, Scalar(0.0), Scalar(1.0), eps / length, max_iterations);
+
+    statistic.result = left + sub_statistic.result * segment;
+    statistic.accuracy = sub_statistic.accuracy * length;
+    statistic.iterations = sub_statistic.iterations;
+    statistic.function_probes = sub_statistic.function_probes;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> per_coord_descend(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& start, 
+    const non_deduced_t<Scalar> step,
+    const non_deduced_t<Scalar> eps, 
+    const uint64_t max_iterations,
+    const search_method_type_nd line_search_type
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called multi dimensional per_coord_descend method with parameters:\nstart = " << start 
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::PER_COORD_DESCEND;
+
+    vector_t<Scalar> x_0(start), ort = vector_t<Scalar>::Zero(start.size());
+
+    uint64_t coord_i, iteration, optimized_coord_count = 0;
+    Scalar x_i;
+    for (iteration = 0; iteration < max_iterations; ++iteration) {
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << iteration + 1 << ": x = " << x_0 << '\n';
+        #endif
+        coord_i = iteration % start.size();
+        ort[coord_i] = 1;
+
+        if (function_nd(x_0 - eps * ort) > function_nd(x_0 + eps * ort)) {
+            ort[coord_i] = step;
+        } else {
+            ort[coord_i] = -step;
+        }
+        
+        x_i = x_0[coord_i];
+
+        auto sub_statistic = mo_optim_detail::line_search<Scalar>(function_nd, x_0, x_0 + ort, eps, line_search_type);
+
+        x_0 = sub_statistic.result;
+        statistic.result = x_0;
+        statistic.accuracy = sub_statistic.accuracy;
+        statistic.iterations += sub_statistic.iterations;
+        statistic.function_probes += sub_statistic.function_probes + 2;
+    
+        if (std::abs(x_0[coord_i] - x_i) < 2.0 * eps) {
+            ++optimized_coord_count;
+            
+            if (optimized_coord_count == start.size()) {
+                break;
+            }
+        } else {
+            optimized_coord_count = 0;
+        }
+
+        ort[coord_i] = 0;
+    }
+    
+    statistic.iterations += iteration;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> gradient_descend(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& start, 
+    const non_deduced_t<Scalar> eps, 
+    const uint64_t max_iterations,
+    const search_method_type_nd line_search_type
+) {
+
+    #ifdef __DEBUG__
+        std::cout << "Called multi dimensional gradient_descend method with parameters:\nstart = " << start 
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::GRADIENT_DESCEND;
+
+    vector_t<Scalar> curr(start.size()), prev(start), grad(start.size());
+
+    uint64_t iteration;
+    for (iteration = 0; iteration != max_iterations; ++iteration) {
+        grad = gradient(function_nd, prev);
+        curr = prev - grad;
+
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << iteration + 1 << ": curr = " << curr << ", prev = " << prev << ", gradient = " << grad << '\n';
+        #endif
+
+        auto sub_statistic = mo_optim_detail::line_search<Scalar>(function_nd, prev, curr, eps, line_search_type);
+
+        curr = sub_statistic.result;
+        statistic.iterations += sub_statistic.iterations;
+        statistic.function_probes += sub_statistic.function_probes + 2;
+
+        if ((statistic.accuracy = distance(prev, curr)) < 2.0 * eps) {
+            break;
+        }
+
+        prev = curr;
+    }
+
+    statistic.iterations += iteration;
+
+    statistic.result = (prev + curr) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> conj_gradient_descend(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& start, 
+    const non_deduced_t<Scalar> eps, 
+    const uint64_t max_iterations,
+    const search_method_type_nd line_search_type
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called multi dimensional conjugate_gradient_descend method with parameters:\nstart = " << start 
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::CONJ_GRADIENT_DESCEND;
+
+    vector_t<Scalar> curr(start.size()), prev(start);
+    vector_t<Scalar> curr_s, prev_s = -gradient<Scalar>(function_nd, prev);
+
+    Scalar omega;
+
+    uint64_t iteration;
+    for (iteration = 0; iteration != max_iterations; ++iteration) {
+        curr = prev + prev_s;
+
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << iteration + 1 << ": curr = " << curr << ", prev = " << prev << '\n';
+        #endif
+
+        if ((statistic.accuracy = distance(prev, curr)) < 2.0 * eps) {
+            break;
+        }
+
+        auto sub_statistic = mo_optim_detail::line_search<Scalar>(function_nd, prev, curr, eps, line_search_type);
+
+        curr = sub_statistic.result;
+        statistic.iterations += sub_statistic.iterations;
+        statistic.function_probes += sub_statistic.function_probes + 2;
+
+        curr_s = gradient(function_nd, curr);
+        omega = curr_s.norm() / prev_s.norm();
+        prev_s = omega * prev_s - curr_s;
+
+        prev = curr;
+    }
+
+    statistic.iterations += iteration;
+
+    statistic.result = (prev + curr) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> newtone_raphson(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& start, 
+    const non_deduced_t<Scalar> eps, 
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called multi dimensional newtone_raphson method with parameters:\nstart = " << start 
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::NEWTONE_RAPHSON;
+
+    vector_t<Scalar> curr, prev(start), grad;
+    matrix_t<Scalar> hess(start.size(), start.size());
+
+    for (; statistic.iterations != max_iterations; ++statistic.iterations) {
+        grad = gradient(function_nd, prev);
+        hess = hessian(function_nd, prev).inverse();
+        curr = prev - (hess * grad);
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations + 1 << ": curr = " << curr << ", prev = " << prev << ", gradient = " << grad << '\n';
+        #endif
+
+        if ((statistic.accuracy = distance(prev, curr)) < 2.0 * eps) {
+            break;
+        }
+
+        prev = curr;
+    }
+
+    statistic.result = (prev + curr) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+    statistic.function_probes = statistic.iterations * 2 * start.size() * (start.size() + 2);
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> projected_gradient_descend(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& start, 
+    const non_deduced_t<vector_t<Scalar>>& lower, 
+    const non_deduced_t<vector_t<Scalar>>& upper, 
+    const non_deduced_t<Scalar> eps, 
+    const uint64_t max_iterations,
+    const search_method_type_nd line_search_type
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called multi dimensional projected_gradient_descend method with parameters:\nstart = " << start 
+        << ";\nlower = " << lower << ";\nupper = " << upper << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    if ((lower.array() > upper.array()).any()) {
+        throw std::runtime_error("Lower bound exceeds upper bound");
+    }
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::PROJECTED_GRADIENT_DESCEND;
+
+    vector_t<Scalar> curr, prev = project(start, lower, upper);
+    vector_t<Scalar> grad = gradient<Scalar>(function_nd, prev, lower, upper), step(start.size());
+    std::vector<uint32_t> coords = free_coords(prev, grad, lower, upper);
+
+    statistic.function_probes = 2 * start.size();
+
+    uint64_t iteration;
+    for (iteration = 0; iteration != max_iterations; ++iteration) {
+        step.setZero();
+        for (auto coord : coords) {
+            step[coord] = grad[coord];
+        }
+
+        curr = project(vector_t<Scalar>(prev - step), lower, upper);
+
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << iteration + 1 << ": curr = " << curr << ", prev = " << prev 
+            << ", free coordinates = " << coords.size() << '\n';
+        #endif
+
+        // Both ends lie within the bounds, hence so does the segment between them, but not the ray beyond.
+        auto sub_statistic = mo_optim_detail::line_search<Scalar>(function_nd, prev, curr, eps, line_search_type, true);
+
+        curr = project(sub_statistic.result, lower, upper);
+        statistic.iterations += sub_statistic.iterations;
+        statistic.function_probes += sub_statistic.function_probes;
+
+        if ((statistic.accuracy = distance(prev, curr)) < 2.0 * eps) {
+            // Free coordinates have converged: only a full gradient tells whether a bound can be left.
+            grad = gradient<Scalar>(function_nd, curr, lower, upper);
+            statistic.function_probes += 2 * start.size();
+
+            std::vector<uint32_t> released = free_coords(curr, grad, lower, upper);
+            if (released == coords) {
+                break;
+            }
+
+            coords = released;
+            prev = curr;
+            continue;
+        }
+
+        prev = curr;
+
+        for (auto coord : coords) {
+            grad[coord] = partial<Scalar>(function_nd, prev, coord, lower, upper);
+        }
+        statistic.function_probes += 2 * coords.size();
+
+        coords = free_coords(prev, grad, lower, upper);
+    }
+
+    statistic.iterations += iteration;
+
+    statistic.result = (prev + curr) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> projected_newtone_raphson(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& start, 
+    const non_deduced_t<vector_t<Scalar>>& lower, 
+    const non_deduced_t<vector_t<Scalar>>& upper, 
+    const non_deduced_t<Scalar> eps, 
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called multi dimensional projected_newtone_raphson method with parameters:\nstart = " << start 
+        << ";\nlower = " << lower << ";\nupper = " << upper << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    if ((lower.array() > upper.array()).any()) {
+        throw std::runtime_error("Lower bound exceeds upper bound");
+    }
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::PROJECTED_NEWTONE_RAPHSON;
+
+    vector_t<Scalar> curr, prev = project(start, lower, upper);
+    vector_t<Scalar> grad = gradient<Scalar>(function_nd, prev, lower, upper), step(start.size());
+    std::vector<uint32_t> coords = free_coords(prev, grad, lower, upper);
+
+    statistic.function_probes = 2 * start.size();
+
+    for (; statistic.iterations != max_iterations; ++statistic.iterations) {
+        step.setZero();
+
+        if (!coords.empty()) {
+            vector_t<Scalar> grad_free(coords.size());
+            for (uint32_t i = 0; i < coords.size(); ++i) {
+                grad_free[i] = grad[coords[i]];
+            }
+
+            matrix_t<Scalar> hess = hessian<Scalar>(function_nd, prev, coords, lower, upper).inverse();
+            statistic.function_probes += 2 * coords.size() * (coords.size() + 1);
+
+            vector_t<Scalar> step_free = hess * grad_free;
+            for (uint32_t i = 0; i < coords.size(); ++i) {
+                step[coords[i]] = step_free[i];
+            }
+        }
+
+        curr = project(vector_t<Scalar>(prev - step), lower, upper);
+
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations + 1 << ": curr = " << curr << ", prev = " << prev 
+            << ", free coordinates = " << coords.size() << '\n';
+        #endif
+
+        if ((statistic.accuracy = distance(prev, curr)) < 2.0 * eps) {
+            grad = gradient<Scalar>(function_nd, curr, lower, upper);
+            statistic.function_probes += 2 * start.size();
+
+            std::vector<uint32_t> released = free_coords(curr, grad, lower, upper);
+            if (released == coords) {
+                break;
+            }
+
+            coords = released;
+            prev = curr;
+            continue;
+        }
+
+        prev = curr;
+
+        for (auto coord : coords) {
+            grad[coord] = partial<Scalar>(function_nd, prev, coord, lower, upper);
+        }
+        statistic.function_probes += 2 * coords.size();
+
+        coords = free_coords(prev, grad, lower, upper);
+    }
+
+    statistic.result = (prev + curr) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+
+    return statistic;
+}
+
+namespace mo_optim_detail {
+    template <typename Scalar>
+    inline search_result_nd_t<Scalar> descend(
+        const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+        const non_deduced_t<vector_t<Scalar>>& start, 
+        const search_method_type_nd method, 
+        const non_deduced_t<Scalar> eps, 
+        const uint64_t max_iterations
+    ) {
+        switch (method) {
+            case search_method_type_nd::PER_COORD_DESCEND:
+                return per_coord_descend<Scalar>(function_nd, start, PER_COORD_DESCEND_STEP, eps, max_iterations);
+            case search_method_type_nd::GRADIENT_DESCEND:
+                return gradient_descend<Scalar>(function_nd, start, eps, max_iterations);
+            case search_method_type_nd::CONJ_GRADIENT_DESCEND:
+                return conj_gradient_descend<Scalar>(function_nd, start, eps, max_iterations);
+            case search_method_type_nd::NEWTONE_RAPHSON:
+                return newtone_raphson<Scalar>(function_nd, start, eps, max_iterations);
+            default:
+                throw std::runtime_error("Mixed precision requires a descend method");
+        }
+    }
+}
+
+template <typename Low, typename High>
+search_result_nd_t<High> mixed_precision(
+    const non_deduced_t<function_nd_t<Low>> function_nd_low, 
+    const non_deduced_t<function_nd_t<High>> function_nd, 
+    const non_deduced_t<vector_t<High>>& start, 
+    const search_method_type_nd method, 
+    const non_deduced_t<High> eps, 
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called multi dimensional mixed_precision method with parameters:\nstart = " << start 
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<High> statistic;
+    statistic.type = method;
+
+    const Low switch_eps = std::max(static_cast<Low>(eps), std::sqrt(std::numeric_limits<Low>::epsilon()));
+
+    auto coarse_statistic = mo_optim_detail::descend<Low>(function_nd_low, start.template cast<Low>(), method, switch_eps, max_iterations);
+
+    #ifdef __DEBUG__
+        std::cout << "Switching precision at " << coarse_statistic.result << " after " << coarse_statistic.iterations << " iterations\n";
+    #endif
+
+    statistic.result = coarse_statistic.result.template cast<High>();
+    statistic.accuracy = coarse_statistic.accuracy;
+    statistic.iterations = coarse_statistic.iterations;
+    statistic.function_probes = coarse_statistic.function_probes;
+
+    auto fine_statistic = mo_optim_detail::descend<High>(function_nd, statistic.result, method, eps, max_iterations);
+
+    statistic.result = fine_statistic.result;
+    statistic.accuracy = fine_statistic.accuracy;
+    statistic.iterations += fine_statistic.iterations;
+    statistic.function_probes += fine_statistic.function_probes;
+
+    return statistic;
+}
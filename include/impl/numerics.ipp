@@ -0,0 +1,201 @@
+#pragma once
+#include <iostream>
+#include <Eigen/Dense>
+
+#include "common.h"
+#include "numerics.h"
+
+template <typename Scalar>
+vector_t<Scalar> direction(const vector_t<Scalar>& left, const vector_t<Scalar>& right) {
+    if (left.size() != right.size()) {
+        throw std::runtime_error("Dimensions of vectors are not equal");
+    }
+
+    return (right - left).normalized();
+}
+
+template <typename Scalar>
+Scalar partial(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, uint32_t index) {
+    if (index >= point.size()) {
+        throw std::runtime_error("Index value is out of vector indices range");
+    }
+
+    const Scalar dx = differential_step<Scalar>();
+
+    point[index] += dx;
+    Scalar y_1 = function_nd(point);
+    point[index] -= Scalar(2.0) * dx;
+    Scalar y_2 = function_nd(point);
+    point[index] += dx;
+
+    return ((y_1 - y_2) / (Scalar(2.0) * dx));
+}
+
+template <typename Scalar>
+Scalar partial2(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, uint32_t index1, uint32_t index2) {
+    if (index2 >= point.size()) {
+        throw std::runtime_error("Index value is out of vector indices range");
+    }
+
+    const Scalar dx = differential_step<Scalar>();
+
+    point[index2] += dx;
+    Scalar y_1 = partial<Scalar>(function_nd, point, index1);
+    point[index2] -= Scalar(2.0) * dx;
+    Scalar y_2 = partial<Scalar>(function_nd, point, index1);
+    point[index2] += dx;
+
+    return ((y_1 - y_2) / (Scalar(2.0) * dx));
+}
+
+template <typename Scalar>
+vector_t<Scalar> gradient(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point) {
+    vector_t<Scalar> grad(point.size());
+
+    for (int i = 0; i < grad.size(); ++i) {
+        grad[i] = partial<Scalar>(function_nd, point, i);
+    }
+
+    return grad;
+}
+
+template <typename Scalar>
+matrix_t<Scalar> hessian(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point) {
+    matrix_t<Scalar> result(point.size(), point.size());
+
+    for (uint32_t row = 0; row < result.rows(); ++row) {
+        for (uint32_t col = row; col < result.cols(); ++col) {
+            result(col, row) = result(row, col) = partial2<Scalar>(function_nd, point, row, col);
+        }
+    }
+
+    return result;
+}
+
+template <typename Scalar>
+matrix_t<Scalar> hessian(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, const std::vector<uint32_t>& coords) {
+    matrix_t<Scalar> result(coords.size(), coords.size());
+
+    for (uint32_t row = 0; row < result.rows(); ++row) {
+        for (uint32_t col = row; col < result.cols(); ++col) {
+            result(col, row) = result(row, col) = partial2<Scalar>(function_nd, point, coords[row], coords[col]);
+        }
+    }
+
+    return result;
+}
+
+template <typename Scalar>
+Scalar partial(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, uint32_t index, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper) {
+    if (index >= point.size()) {
+        throw std::runtime_error("Index value is out of vector indices range");
+    }
+
+    const Scalar dx = differential_step<Scalar>();
+    const Scalar x = point[index];
+    const Scalar right = (x + dx <= upper[index]) ? x + dx : x;
+    const Scalar left = (x - dx >= lower[index]) ? x - dx : x;
+
+    if (right == left) {
+        return partial<Scalar>(function_nd, point, index);
+    }
+
+    point[index] = right;
+    Scalar y_1 = function_nd(point);
+    point[index] = left;
+    Scalar y_2 = function_nd(point);
+    point[index] = x;
+
+    return ((y_1 - y_2) / (right - left));
+}
+
+template <typename Scalar>
+Scalar partial2(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, uint32_t index1, uint32_t index2, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper) {
+    if (index2 >= point.size()) {
+        throw std::runtime_error("Index value is out of vector indices range");
+    }
+
+    const Scalar dx = differential_step<Scalar>();
+    const Scalar x = point[index2];
+    const Scalar right = (x + dx <= upper[index2]) ? x + dx : x;
+    const Scalar left = (x - dx >= lower[index2]) ? x - dx : x;
+
+    if (right == left) {
+        return partial2<Scalar>(function_nd, point, index1, index2);
+    }
+
+    point[index2] = right;
+    Scalar y_1 = partial<Scalar>(function_nd, point, index1, lower, upper);
+    point[index2] = left;
+    Scalar y_2 = partial<Scalar>(function_nd, point, index1, lower, upper);
+    point[index2] = x;
+
+    return ((y_1 - y_2) / (right - left));
+}
+
+template <typename Scalar>
+vector_t<Scalar> gradient(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper) {
+    vector_t<Scalar> grad(point.size());
+
+    for (int i = 0; i < grad.size(); ++i) {
+        grad[i] = partial<Scalar>(function_nd, point, i, lower, upper);
+    }
+
+    return grad;
+}
+
+template <typename Scalar>
+matrix_t<Scalar> hessian(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, const std::vector<uint32_t>& coords, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper) {
+    matrix_t<Scalar> result(coords.size(), coords.size());
+
+    for (uint32_t row = 0; row < result.rows(); ++row) {
+        for (uint32_t col = row; col < result.cols(); ++col) {
+            result(col, row) = result(row, col) = partial2<Scalar>(function_nd, point, coords[row], coords[col], lower, upper);
+        }
+    }
+
+    return result;
+}
+
+template <typename Scalar>
+vector_t<Scalar> project(const vector_t<Scalar>& point, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper) {
+    if (point.size() != lower.size() || point.size() != upper.size()) {
+        throw std::runtime_error("Dimensions of vectors are not equal");
+    }
+
+    return point.cwiseMax(lower).cwiseMin(upper);
+}
+
+template <typename Scalar>
+std::vector<uint32_t> free_coords(const vector_t<Scalar>& point, const vector_t<Scalar>& grad, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper) {
+    std::vector<uint32_t> coords;
+
+    for (uint32_t i = 0; i < point.size(); ++i) {
+        if ((point[i] <= lower[i] && grad[i] > 0) || (point[i] >= upper[i] && grad[i] < 0)) {
+            continue;
+        }
+        coords.push_back(i);
+    }
+
+    return coords;
+}
+
+template <typename Scalar>
+Scalar distance(const vector_t<Scalar>& left, const vector_t<Scalar>& right) {
+    if (left.size() != right.size()) {
+        throw std::runtime_error("Dimensions of vectors are not equal");
+    }
+
+    return (right - left).norm();
+}
+
+template <typename Scalar>
+std::ostream& operator<<(std::ostream& stream, const vector_t<Scalar>& vec) {
+    stream << '[' << vec[0];
+    for (int i = 1; i < vec.size(); ++i) {
+        stream << ',' << ' ' << vec[i]; 
+    }
+    stream << ']';
+
+    return stream;
+}
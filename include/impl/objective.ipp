@@ -0,0 +1,338 @@
+#pragma once
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "common.h"
+#include "objective.h"
+#include "search_result_nd.h"
+#include "numerics.h"
+
+namespace mo_optim_detail {
+    // Armijo backtracking from x along dir, starting at step. The first trial is evaluated fused, as it is
+    // usually accepted and its gradient is needed by the next iteration; the following trials probe the
+    // value only (step picked by quadratic interpolation), and the accepted one is re-evaluated fused.
+    // With curvature != 0 the accepted step is then refined by secant steps on the directional derivative
+    // until the strong Wolfe condition |grad(to) * dir| <= curvature * |grad * dir| holds.
+    // Returns false when dir is not a descend direction or the move shrinks below eps.
+    template <typename Objective, typename Scalar>
+    inline bool fused_line_search(
+        const Objective& objective,
+        const vector_t<Scalar>& from,
+        const Scalar value,
+        const vector_t<Scalar>& grad,
+        const vector_t<Scalar>& dir,
+        Scalar& step,
+        vector_t<Scalar>& to,
+        Scalar& to_value,
+        vector_t<Scalar>& to_grad,
+        const Scalar eps,
+        const Scalar curvature,
+        search_result_nd_t<Scalar>& statistic
+    ) {
+        const Scalar slope = grad.dot(dir);
+        const Scalar length = dir.norm();
+
+        if (!(slope < 0)) {
+            return false;
+        }
+
+        to = from + step * dir;
+        to_value = objective.value_and_gradient(to, to_grad);
+        ++statistic.gradient_evaluations;
+
+        if (to_value <= value + Scalar(ARMIJO_SLOPE) * step * slope) {
+            Scalar left = 0.0, left_slope = slope, trial_value;
+            vector_t<Scalar> trial, trial_grad;
+
+            for (uint32_t i = 0; i < SECANT_STEPS && curvature != 0; ++i) {
+                const Scalar to_slope = to_grad.dot(dir);
+                if (std::abs(to_slope) <= -curvature * slope) {
+                    break;
+                }
+
+                Scalar trial_step = step - to_slope * (step - left) / (to_slope - left_slope);
+                if (!std::isfinite(trial_step) || trial_step <= 0) {
+                    trial_step = Scalar(2.0) * step;
+                }
+
+                trial = from + trial_step * dir;
+                trial_value = objective.value_and_gradient(trial, trial_grad);
+                ++statistic.gradient_evaluations;
+                #ifdef __DEBUG__
+                    std::cout << "Secant step: step = " << trial_step << ", value = " << trial_value << '\n';
+                #endif
+
+                if (trial_value > to_value || trial_value > value + Scalar(ARMIJO_SLOPE) * trial_step * slope) {
+                    break;
+                }
+
+                left = step;
+                left_slope = to_slope;
+                step = trial_step;
+                to.swap(trial);
+                to_grad.swap(trial_grad);
+                to_value = trial_value;
+            }
+
+            return true;
+        }
+
+        while (true) {
+            const Scalar interpolated = -slope * step * step / (Scalar(2.0) * (to_value - value - slope * step));
+            step = std::isfinite(interpolated) ? std::min(std::max(interpolated, Scalar(0.1) * step), Scalar(0.5) * step) : Scalar(0.5) * step;
+
+            if (step * length < eps) {
+                return false;
+            }
+
+            to = from + step * dir;
+            to_value = objective.value(to);
+            ++statistic.function_probes;
+            #ifdef __DEBUG__
+                std::cout << "Backtracking: step = " << step << ", value = " << to_value << '\n';
+            #endif
+
+            if (to_value <= value + Scalar(ARMIJO_SLOPE) * step * slope) {
+                to_value = objective.value_and_gradient(to, to_grad);
+                ++statistic.gradient_evaluations;
+                return true;
+            }
+        }
+    }
+
+    // Step expected to repeat the last decrease along a direction with the given slope.
+    template <typename Scalar>
+    inline Scalar next_step(const Scalar step, const Scalar decrease, const Scalar slope) {
+        const Scalar expected = Scalar(2.02) * decrease / slope;
+        return (std::isfinite(expected) && expected > 0) ? expected : step;
+    }
+
+    // Newton direction by conjugate gradients on H d = -grad, stopped on negative curvature
+    // or once the residual drops below min(0.5, sqrt(|grad|)) * |grad|.
+    template <typename Objective, typename Scalar>
+    inline vector_t<Scalar> newton_direction(
+        const Objective& objective,
+        const vector_t<Scalar>& point,
+        const vector_t<Scalar>& grad,
+        search_result_nd_t<Scalar>& statistic,
+        std::true_type
+    ) {
+        const Scalar grad_norm = grad.norm();
+        const Scalar tolerance = std::min(Scalar(0.5), std::sqrt(grad_norm)) * grad_norm;
+
+        vector_t<Scalar> dir = vector_t<Scalar>::Zero(point.size());
+        vector_t<Scalar> residual = -grad, conj = residual, product;
+        Scalar residual_norm = residual.squaredNorm();
+
+        for (uint32_t i = 0; i < point.size(); ++i) {
+            product = objective.hessian_vector_product(point, conj);
+            ++statistic.hessian_vector_products;
+
+            const Scalar curvature = conj.dot(product);
+            if (!(curvature > 0)) {
+                return i == 0 ? vector_t<Scalar>(-grad) : dir;
+            }
+
+            const Scalar alpha = residual_norm / curvature;
+            dir += alpha * conj;
+            residual -= alpha * product;
+
+            const Scalar next_norm = residual.squaredNorm();
+            if (std::sqrt(next_norm) < tolerance) {
+                break;
+            }
+
+            conj = residual + (next_norm / residual_norm) * conj;
+            residual_norm = next_norm;
+        }
+
+        return dir;
+    }
+
+    // Newton direction from the Hessian taken by central differences of the exact gradients.
+    template <typename Objective, typename Scalar>
+    inline vector_t<Scalar> newton_direction(
+        const Objective& objective,
+        const vector_t<Scalar>& point,
+        const vector_t<Scalar>& grad,
+        search_result_nd_t<Scalar>& statistic,
+        std::false_type
+    ) {
+        const Scalar dx = differential_step<Scalar>();
+        matrix_t<Scalar> hess(point.size(), point.size());
+        vector_t<Scalar> shifted(point), grad_right, grad_left;
+
+        for (uint32_t i = 0; i < point.size(); ++i) {
+            shifted(i) = point(i) + dx;
+            objective.value_and_gradient(shifted, grad_right);
+            shifted(i) = point(i) - dx;
+            objective.value_and_gradient(shifted, grad_left);
+            shifted(i) = point(i);
+            hess.col(i) = (grad_right - grad_left) / (Scalar(2.0) * dx);
+        }
+        statistic.gradient_evaluations += 2 * point.size();
+
+        const Eigen::LDLT<matrix_t<Scalar>> factorization((hess + hess.transpose()) * Scalar(0.5));
+        if (factorization.info() != Eigen::Success || !factorization.isPositive()) {
+            return -grad;
+        }
+
+        return factorization.solve(-grad);
+    }
+}
+
+template <typename Objective, typename Scalar, typename>
+search_result_nd_t<Scalar> gradient_descend(
+    const Objective& objective,
+    const non_deduced_t<vector_t<Scalar>>& start,
+    const non_deduced_t<Scalar> eps,
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called fused gradient_descend method with parameters:\nstart = " << start
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::GRADIENT_DESCEND;
+
+    vector_t<Scalar> curr(start), prev(start), grad, next_grad, dir;
+    Scalar value = objective.value_and_gradient(prev, grad), next_value;
+    Scalar step = Scalar(1.0) / std::max(grad.norm(), Scalar(1.0));
+    ++statistic.gradient_evaluations;
+
+    for (; statistic.iterations != max_iterations; ++statistic.iterations) {
+        dir = -grad;
+        if (!mo_optim_detail::fused_line_search(objective, prev, value, grad, dir, step, curr, next_value, next_grad, Scalar(eps), Scalar(0.0), statistic)) {
+            curr = prev;
+            statistic.accuracy = step * dir.norm();
+            break;
+        }
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations + 1 << ": curr = " << curr << ", prev = " << prev << ", gradient = " << grad << '\n';
+        #endif
+
+        if ((statistic.accuracy = distance(prev, curr)) < 2.0 * eps) {
+            break;
+        }
+
+        step = mo_optim_detail::next_step(step, next_value - value, Scalar(-next_grad.squaredNorm()));
+        prev = curr;
+        value = next_value;
+        grad = next_grad;
+    }
+
+    statistic.result = (prev + curr) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+
+    return statistic;
+}
+
+template <typename Objective, typename Scalar, typename>
+search_result_nd_t<Scalar> conj_gradient_descend(
+    const Objective& objective,
+    const non_deduced_t<vector_t<Scalar>>& start,
+    const non_deduced_t<Scalar> eps,
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called fused conj_gradient_descend method with parameters:\nstart = " << start
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::CONJ_GRADIENT_DESCEND;
+
+    vector_t<Scalar> curr(start), prev(start), grad, next_grad;
+    Scalar value = objective.value_and_gradient(prev, grad), next_value;
+    vector_t<Scalar> dir = -grad;
+    Scalar step = Scalar(1.0) / std::max(grad.norm(), Scalar(1.0));
+    ++statistic.gradient_evaluations;
+
+    for (; statistic.iterations != max_iterations; ++statistic.iterations) {
+        if (!(grad.dot(dir) < 0)) {
+            dir = -grad;
+        }
+
+        if (!mo_optim_detail::fused_line_search(objective, prev, value, grad, dir, step, curr, next_value, next_grad, Scalar(eps), Scalar(WOLFE_CURVATURE), statistic)) {
+            curr = prev;
+            statistic.accuracy = step * dir.norm();
+            break;
+        }
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations + 1 << ": curr = " << curr << ", prev = " << prev << ", direction = " << dir << '\n';
+        #endif
+
+        if ((statistic.accuracy = distance(prev, curr)) < 2.0 * eps) {
+            break;
+        }
+
+        Scalar beta = std::max(Scalar(0.0), next_grad.dot(next_grad - grad) / grad.squaredNorm());
+        if ((statistic.iterations + 1) % uint64_t(start.size()) == 0 || !std::isfinite(beta)) {
+            beta = 0.0;
+        }
+        dir = -next_grad + beta * dir;
+
+        step = mo_optim_detail::next_step(step, next_value - value, Scalar(next_grad.dot(dir)));
+        prev = curr;
+        value = next_value;
+        grad = next_grad;
+    }
+
+    statistic.result = (prev + curr) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+
+    return statistic;
+}
+
+template <typename Objective, typename Scalar, typename>
+search_result_nd_t<Scalar> newtone_raphson(
+    const Objective& objective,
+    const non_deduced_t<vector_t<Scalar>>& start,
+    const non_deduced_t<Scalar> eps,
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called fused newtone_raphson method with parameters:\nstart = " << start
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::NEWTONE_RAPHSON;
+
+    vector_t<Scalar> curr(start), prev(start), grad, next_grad, dir;
+    Scalar value = objective.value_and_gradient(prev, grad), next_value, step;
+    ++statistic.gradient_evaluations;
+
+    for (; statistic.iterations != max_iterations; ++statistic.iterations) {
+        dir = mo_optim_detail::newton_direction(objective, prev, grad, statistic, has_hessian_vector_product<Objective, Scalar>());
+        if (!(grad.dot(dir) < 0)) {
+            dir = -grad;
+        }
+
+        step = 1.0;
+        if (!mo_optim_detail::fused_line_search(objective, prev, value, grad, dir, step, curr, next_value, next_grad, Scalar(eps), Scalar(0.0), statistic)) {
+            curr = prev;
+            statistic.accuracy = step * dir.norm();
+            break;
+        }
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations + 1 << ": curr = " << curr << ", prev = " << prev << ", gradient = " << grad << '\n';
+        #endif
+
+        if ((statistic.accuracy = distance(prev, curr)) < 2.0 * eps) {
+            break;
+        }
+
+        prev = curr;
+        value = next_value;
+        grad = next_grad;
+    }
+
+    statistic.result = (prev + curr) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+
+    return statistic;
+}
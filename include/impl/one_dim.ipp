@@ -0,0 +1,352 @@
+#pragma once
+#include <functional>
+#include <cmath>
+#include <algorithm>
+#include "one_dim.h"
+#include "common.h"
+#include "numerics.h"
+#include "search_result.h"
+
+template <typename Scalar>
+search_result_t<Scalar> bisect(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar> left, non_deduced_t<Scalar> right, const non_deduced_t<Scalar> eps, const uint64_t max_iterations) {
+    #ifdef __DEBUG__
+        std::cout << "Called one dimensional bisect method with parameters: left = " << left << "; right = " << right 
+        << "; eps =" << eps << "; max_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_t<Scalar> statistic;
+    statistic.type = search_method_type::BISECT;
+
+    while (statistic.iterations != max_iterations && (statistic.accuracy = std::abs(right - left)) >= Scalar(2.0) * eps) {
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations + 1 << ": left = " << left
+             << "; right = " << right << "; accuracy = " << statistic.accuracy << '\n';
+        #endif
+
+        statistic.result = (left + right) * Scalar(0.5);
+        
+        Scalar x_l = statistic.result - eps * Scalar(0.1);
+        Scalar x_r = statistic.result + eps * Scalar(0.1);
+
+        if (function(x_l) > function(x_r)) {
+            left = x_l;
+        } else {
+            right = x_r;
+        }
+
+        ++statistic.iterations;
+    }
+
+    statistic.function_probes = 2 * statistic.iterations;
+    statistic.accuracy *= 0.5;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_t<Scalar> golden_ratio(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar> left, non_deduced_t<Scalar> right, const non_deduced_t<Scalar> eps, const uint64_t max_iterations) {
+    #ifdef __DEBUG__
+        std::cout << "Called one dimensional golden ratio method with parameters: left = " << left << "; right = " << right 
+        << "; eps =" << eps << "; max_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_t<Scalar> statistic;
+    statistic.type = search_method_type::GOLDEN_RATIO;
+
+    Scalar x_r = left + Scalar(PSI) * (right - left);
+    Scalar x_l = right - Scalar(PSI) * (right - left);
+
+    Scalar y_l = function(x_l);
+    Scalar y_r = function(x_r);
+
+    while (statistic.iterations != max_iterations && (statistic.accuracy = std::abs(right - left)) >= Scalar(2.0) * eps) {
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations + 1 << ": left = " << left
+             << "; right = " << right << "; accuracy = " << statistic.accuracy << '\n';
+        #endif
+        if (y_l > y_r) {
+            left = x_l;
+            x_l = x_r;
+            y_l = y_r;
+            x_r = left + Scalar(PSI) * (right - left);
+            y_r = function(x_r);
+        } else {
+            right = x_r;
+            x_r = x_l;
+            y_r = y_l;
+            x_l = right - Scalar(PSI) * (right - left);
+            y_l = function(x_l);
+        }
+
+        ++statistic.iterations;
+    }
+
+    statistic.function_probes = statistic.iterations + 2;
+    statistic.result = (left + right) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_t<Scalar> fibonacchi(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar> left, non_deduced_t<Scalar> right, const non_deduced_t<Scalar> eps) {
+    #ifdef __DEBUG__
+        std::cout << "Called one dimensional fibonacchi method with parameters: left = " << left << "; right = " << right 
+        << "; eps =" << eps << '\n';
+    #endif
+
+    search_result_t<Scalar> statistic;
+    statistic.type = search_method_type::FIBONACCHI;
+
+    uint64_t fib_1 = 1, fib_2 = 1;
+    Scalar threshold = (right - left) / eps;
+
+    while (fib_2 < threshold && fib_2 <= FIB_LIMIT) {
+        fib_next(fib_1, fib_2);
+        ++statistic.iterations;
+    }
+
+    Scalar x_r = left + Scalar(fib_1) / Scalar(fib_2) * (right - left);
+    Scalar x_l = left + Scalar(fib_2 - fib_1) / Scalar(fib_2) * (right - left);
+
+    Scalar y_r = function(x_r);
+    Scalar y_l = function(x_l);
+    for (uint64_t iterations = statistic.iterations; iterations > 0; --iterations) {
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations - iterations + 1 << ": left = " << left
+             << "; right = " << right << "; accuracy = " << std::abs(right - left) / 2 << '\n';
+        #endif
+        fib_prev(fib_1, fib_2);
+        if (y_l > y_r) {
+            left = x_l;
+            x_l = x_r;
+            y_l = y_r;
+            x_r = left + Scalar(fib_1) / Scalar(fib_2) * (right - left);
+            y_r = function(x_r);
+        } else {
+            right = x_r;
+            x_r = x_l;
+            y_r = y_l;
+            x_l = left + Scalar(fib_2 - fib_1) / Scalar(fib_2) * (right - left);
+            y_l = function(x_l);
+        }
+    }
+
+    statistic.result = (left + right) * Scalar(0.5);
+    statistic.accuracy = std::abs(right - left) * Scalar(0.5);
+    statistic.function_probes = statistic.iterations + 2;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_t<Scalar> bracket(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar>& left, non_deduced_t<Scalar>& right, const non_deduced_t<Scalar> start, const non_deduced_t<Scalar> step, const uint64_t max_iterations) {
+    #ifdef __DEBUG__
+        std::cout << "Called one dimensional bracket method with parameters: start = " << start << "; step = " << step 
+        << "; max_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_t<Scalar> statistic;
+    statistic.type = search_method_type::BRACKET;
+
+    Scalar x_a = start, x_b = start + step;
+    Scalar y_a = function(x_a), y_b = function(x_b);
+
+    if (y_b > y_a) {
+        std::swap(x_a, x_b);
+        std::swap(y_a, y_b);
+    }
+
+    Scalar x_c = x_b + Scalar(PHI) * (x_b - x_a);
+    Scalar y_c = function(x_c);
+
+    statistic.function_probes = 3;
+
+    while (statistic.iterations != max_iterations && y_b > y_c) {
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations + 1 << ": a = " << x_a
+             << "; b = " << x_b << "; c = " << x_c << '\n';
+        #endif
+        ++statistic.iterations;
+
+        Scalar r = (x_b - x_a) * (y_b - y_c);
+        Scalar q = (x_b - x_c) * (y_b - y_a);
+        Scalar denom = Scalar(2.0) * std::copysign(std::max(std::abs(q - r), Scalar(BRENT_TINY)), q - r);
+        Scalar x_u = x_b - ((x_b - x_c) * q - (x_b - x_a) * r) / denom;
+        Scalar x_limit = x_b + Scalar(BRACKET_GROW_LIMIT) * (x_c - x_b);
+        Scalar y_u;
+
+        if ((x_b - x_u) * (x_u - x_c) > 0.0) {
+            y_u = function(x_u);
+            ++statistic.function_probes;
+
+            if (y_u < y_c) {
+                x_a = x_b;
+                y_a = y_b;
+                x_b = x_u;
+                y_b = y_u;
+                break;
+            } else if (y_u > y_b) {
+                x_c = x_u;
+                y_c = y_u;
+                break;
+            }
+
+            x_u = x_c + Scalar(PHI) * (x_c - x_b);
+            y_u = function(x_u);
+            ++statistic.function_probes;
+        } else if ((x_c - x_u) * (x_u - x_limit) > 0.0) {
+            y_u = function(x_u);
+            ++statistic.function_probes;
+
+            if (y_u < y_c) {
+                x_b = x_c;
+                y_b = y_c;
+                x_c = x_u;
+                y_c = y_u;
+                x_u = x_c + Scalar(PHI) * (x_c - x_b);
+                y_u = function(x_u);
+                ++statistic.function_probes;
+            }
+        } else if ((x_u - x_limit) * (x_limit - x_c) >= 0.0) {
+            x_u = x_limit;
+            y_u = function(x_u);
+            ++statistic.function_probes;
+        } else {
+            x_u = x_c + Scalar(PHI) * (x_c - x_b);
+            y_u = function(x_u);
+            ++statistic.function_probes;
+        }
+
+        x_a = x_b;
+        y_a = y_b;
+        x_b = x_c;
+        y_b = y_c;
+        x_c = x_u;
+        y_c = y_u;
+    }
+
+    left = std::min(x_a, x_c);
+    right = std::max(x_a, x_c);
+
+    statistic.result = x_b;
+    statistic.accuracy = (right - left) * Scalar(0.5);
+
+    if (!(y_b <= y_c)) {
+        // Still descending after max_iterations (or the function is not finite): nothing is enclosed.
+        statistic.type = search_method_type::NONE;
+    }
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_t<Scalar> brent(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar> left, non_deduced_t<Scalar> right, const non_deduced_t<Scalar> eps, const uint64_t max_iterations) {
+    #ifdef __DEBUG__
+        std::cout << "Called one dimensional brent method with parameters: left = " << left << "; right = " << right 
+        << "; eps =" << eps << "; max_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_t<Scalar> statistic;
+    statistic.type = search_method_type::BRENT;
+
+    if (left > right) {
+        std::swap(left, right);
+    }
+
+    const Scalar tol_1 = eps * Scalar(0.5);
+    const Scalar tol_2 = eps;
+
+    Scalar x = right - Scalar(PSI) * (right - left), w = x, v = x;
+    Scalar y_x = function(x), y_w = y_x, y_v = y_x;
+    Scalar step = 0.0, prev_step = 0.0;
+
+    statistic.function_probes = 1;
+
+    while (statistic.iterations != max_iterations) {
+        Scalar middle = (left + right) * Scalar(0.5);
+
+        if (std::abs(x - middle) <= tol_2 - (right - left) * Scalar(0.5)) {
+            break;
+        }
+
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations + 1 << ": left = " << left
+             << "; right = " << right << "; x = " << x << '\n';
+        #endif
+
+        bool golden_step = true;
+
+        if (std::abs(prev_step) > tol_1) {
+            Scalar r = (x - w) * (y_x - y_v);
+            Scalar q = (x - v) * (y_x - y_w);
+            Scalar p = (x - v) * q - (x - w) * r;
+            q = Scalar(2.0) * (q - r);
+
+            if (q > 0.0) {
+                p = -p;
+            }
+            q = std::abs(q);
+
+            Scalar step_before_last = prev_step;
+            prev_step = step;
+
+            if (std::abs(p) < std::abs(Scalar(0.5) * q * step_before_last) && p > q * (left - x) && p < q * (right - x)) {
+                step = p / q;
+                golden_step = false;
+
+                Scalar x_u = x + step;
+                if (x_u - left < tol_2 || right - x_u < tol_2) {
+                    step = std::copysign(tol_1, middle - x);
+                }
+            }
+        }
+
+        if (golden_step) {
+            prev_step = (x >= middle ? left : right) - x;
+            step = Scalar(1.0 - PSI) * prev_step;
+        }
+
+        Scalar x_u = std::abs(step) >= tol_1 ? x + step : x + std::copysign(tol_1, step);
+        Scalar y_u = function(x_u);
+        ++statistic.function_probes;
+
+        if (y_u <= y_x) {
+            if (x_u >= x) {
+                left = x;
+            } else {
+                right = x;
+            }
+
+            v = w;
+            y_v = y_w;
+            w = x;
+            y_w = y_x;
+            x = x_u;
+            y_x = y_u;
+        } else {
+            if (x_u < x) {
+                left = x_u;
+            } else {
+                right = x_u;
+            }
+
+            if (y_u <= y_w || w == x) {
+                v = w;
+                y_v = y_w;
+                w = x_u;
+                y_w = y_u;
+            } else if (y_u <= y_v || v == x || v == w) {
+                v = x_u;
+                y_v = y_u;
+            }
+        }
+
+        ++statistic.iterations;
+    }
+
+    statistic.result = x;
+    statistic.accuracy = std::max(x - left, right - x);
+
+    return statistic;
+}
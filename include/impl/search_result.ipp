@@ -0,0 +1,12 @@
+#pragma once
+#include "search_result.h"
+#include "common.h"
+
+template <typename Scalar>
+std::ostream& operator<<(std::ostream& stream, const search_result_t<Scalar>& statistic) {
+    return stream << "Search result = {Search method: " << (search_method_string.begin())[statistic.type] << "; " 
+    << "Extremum of function: " << statistic.result << "; " 
+    << "Accuracy: " << statistic.accuracy << "; " 
+    << "Iterations: " << statistic.iterations << "; " 
+    << "Function probes: " << statistic.function_probes << "}\n";
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "search_result_nd.h"
+#include "common.h"
+#include "numerics.h"
+
+template <typename Scalar>
+std::ostream& operator<<(std::ostream& stream, const search_result_nd_t<Scalar>& statistic) {
+    stream << "Search result = {Search method: " << (search_method_string_nd.begin())[statistic.type] << "; " 
+    << "Extremum of function: " << statistic.result << "; " 
+    << "Accuracy: " << statistic.accuracy << "; " 
+    << "Iterations: " << statistic.iterations << "; " 
+    << "Function probes: " << statistic.function_probes;
+
+    if (statistic.gradient_evaluations != 0 || statistic.hessian_vector_products != 0) {
+        stream << "; Gradient evaluations: " << statistic.gradient_evaluations 
+        << "; Hessian vector products: " << statistic.hessian_vector_products;
+    }
+
+    if (statistic.epochs != 0) {
+        stream << "; Epochs: " << statistic.epochs << "; Batches: " << statistic.batches;
+    }
+
+    stream << "}\n";
+
+    return stream;
+}
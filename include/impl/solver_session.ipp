@@ -0,0 +1,384 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <Eigen/Dense>
+
+#include "common.h"
+#include "multi_dim.h"
+#include "numerics.h"
+#include "search_result_nd.h"
+#include "solver_session.h"
+
+template <typename Scalar>
+solver_session_t<Scalar>::solver_session_t(const vector_t<Scalar>& start, const Scalar drift_tolerance) : drift_tolerance(drift_tolerance) {
+    reset(start);
+}
+
+template <typename Scalar>
+void solver_session_t<Scalar>::reset(const vector_t<Scalar>& start) {
+    last_solution = start;
+    last_value = 0.0;
+    has_value = false;
+    last_drifted = false;
+    has_hessian = false;
+    curvature_pairs.clear();
+    step_scale = 1.0;
+}
+
+template <typename Scalar>
+void solver_session_t<Scalar>::warm_start(const function_nd_t<Scalar>& function_nd, uint64_t& function_probes) {
+    last_drifted = false;
+
+    if (!has_value) {
+        return;
+    }
+
+    Scalar value = function_nd(last_solution);
+    ++function_probes;
+
+    if (std::abs(value - last_value) > drift_tolerance * (1 + std::abs(last_value))) {
+        #ifdef __DEBUG__
+            std::cout << "Session drifted: value at last solution moved from " << last_value << " to " << value << '\n';
+        #endif
+
+        last_drifted = true;
+        has_hessian = false;
+        curvature_pairs.clear();
+        step_scale = 1.0;
+    }
+}
+
+template <typename Scalar>
+void solver_session_t<Scalar>::store(const vector_t<Scalar>& solution, const Scalar value) {
+    last_solution = solution;
+    last_value = value;
+    has_value = true;
+}
+
+template <typename Scalar>
+void solver_session_t<Scalar>::push_pair(const vector_t<Scalar>& step, const vector_t<Scalar>& grad_step) {
+    // Pairs without positive curvature would break the positive definiteness of the update.
+    if (step.dot(grad_step) <= std::numeric_limits<Scalar>::epsilon() * step.norm() * grad_step.norm()) {
+        return;
+    }
+
+    curvature_pairs.emplace_back(step, grad_step);
+
+    if (curvature_pairs.size() > SESSION_HISTORY) {
+        curvature_pairs.pop_front();
+    }
+}
+
+template <typename Scalar>
+vector_t<Scalar> solver_session_t<Scalar>::inverse_hessian_product(const vector_t<Scalar>& grad) const {
+    if (curvature_pairs.empty()) {
+        return step_scale * grad;
+    }
+
+    vector_t<Scalar> result(grad);
+    std::vector<Scalar> alphas(curvature_pairs.size());
+
+    for (size_t i = curvature_pairs.size(); i-- > 0;) {
+        const auto& pair = curvature_pairs[i];
+        alphas[i] = pair.first.dot(result) / pair.first.dot(pair.second);
+        result -= alphas[i] * pair.second;
+    }
+
+    const auto& last_pair = curvature_pairs.back();
+    result *= last_pair.first.dot(last_pair.second) / last_pair.second.squaredNorm();
+
+    for (size_t i = 0; i < curvature_pairs.size(); ++i) {
+        const auto& pair = curvature_pairs[i];
+        Scalar beta = pair.second.dot(result) / pair.first.dot(pair.second);
+        result += (alphas[i] - beta) * pair.first;
+    }
+
+    return result;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> solver_session_t<Scalar>::gradient_descend(
+    const function_nd_t<Scalar> function_nd, 
+    const Scalar eps, 
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called session gradient_descend method with parameters:\nstart = " << last_solution 
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::GRADIENT_DESCEND;
+
+    warm_start(function_nd, statistic.function_probes);
+
+    vector_t<Scalar> curr(last_solution), prev(last_solution), grad, target;
+
+    uint64_t iteration;
+    for (iteration = 0; iteration != max_iterations; ++iteration) {
+        grad = gradient(function_nd, prev);
+        target = prev - step_scale * grad;
+        statistic.function_probes += 2 * prev.size();
+
+        auto sub_statistic = brent<Scalar>(function_nd, prev, target, eps);
+
+        curr = sub_statistic.result;
+        statistic.iterations += sub_statistic.iterations;
+        statistic.function_probes += sub_statistic.function_probes;
+
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << iteration + 1 << ": curr = " << curr << ", prev = " << prev << ", step scale = " << step_scale << '\n';
+        #endif
+
+        // The part of the segment the line search used sizes the next one.
+        Scalar length = distance(prev, target);
+        if (length > 0) {
+            step_scale *= std::max(Scalar(2.0) * distance(prev, curr) / length, Scalar(0.1));
+        }
+
+        if ((statistic.accuracy = distance(prev, curr)) < 2.0 * eps) {
+            break;
+        }
+
+        prev = curr;
+    }
+
+    statistic.iterations += iteration;
+
+    statistic.result = (prev + curr) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+
+    store(statistic.result, function_nd(statistic.result));
+    ++statistic.function_probes;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> solver_session_t<Scalar>::conj_gradient_descend(
+    const function_nd_t<Scalar> function_nd, 
+    const Scalar eps, 
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called session conj_gradient_descend method with parameters:\nstart = " << last_solution 
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::CONJ_GRADIENT_DESCEND;
+
+    warm_start(function_nd, statistic.function_probes);
+
+    vector_t<Scalar> curr(last_solution), prev(last_solution), target;
+    vector_t<Scalar> grad = gradient(function_nd, prev), curr_grad, dir = -grad;
+    statistic.function_probes += 2 * prev.size();
+
+    uint64_t iteration;
+    for (iteration = 0; iteration != max_iterations; ++iteration) {
+        target = prev + step_scale * dir;
+
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << iteration + 1 << ": target = " << target << ", prev = " << prev << ", step scale = " << step_scale << '\n';
+        #endif
+
+        Scalar length = distance(prev, target);
+        if ((statistic.accuracy = length) < 2.0 * eps) {
+            curr = prev;
+            break;
+        }
+
+        auto sub_statistic = brent<Scalar>(function_nd, prev, target, eps);
+
+        curr = sub_statistic.result;
+        statistic.iterations += sub_statistic.iterations;
+        statistic.function_probes += sub_statistic.function_probes;
+
+        step_scale *= std::max(Scalar(2.0) * distance(prev, curr) / length, Scalar(0.1));
+
+        if ((statistic.accuracy = distance(prev, curr)) < 2.0 * eps) {
+            break;
+        }
+
+        curr_grad = gradient(function_nd, curr);
+        statistic.function_probes += 2 * prev.size();
+
+        dir = (curr_grad.squaredNorm() / grad.squaredNorm()) * dir - curr_grad;
+        if (dir.dot(curr_grad) >= 0) {
+            dir = -curr_grad;
+        }
+
+        grad = curr_grad;
+        prev = curr;
+    }
+
+    statistic.iterations += iteration;
+
+    statistic.result = (prev + curr) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+
+    store(statistic.result, function_nd(statistic.result));
+    ++statistic.function_probes;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> solver_session_t<Scalar>::newtone_raphson(
+    const function_nd_t<Scalar> function_nd, 
+    const Scalar eps, 
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called session newtone_raphson method with parameters:\nstart = " << last_solution 
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::NEWTONE_RAPHSON;
+
+    warm_start(function_nd, statistic.function_probes);
+
+    const uint64_t hessian_probes = 2 * last_solution.size() * (last_solution.size() + 1);
+
+    vector_t<Scalar> curr(last_solution), prev(last_solution), curr_grad;
+    vector_t<Scalar> grad = gradient(function_nd, prev);
+    statistic.function_probes += 2 * prev.size();
+
+    bool fresh_factor = false;
+    if (!has_hessian) {
+        hessian_factor.compute(hessian(function_nd, prev));
+        statistic.function_probes += hessian_probes;
+        has_hessian = fresh_factor = true;
+    }
+
+    for (; statistic.iterations != max_iterations; ++statistic.iterations) {
+        curr = prev - hessian_factor.solve(grad);
+
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << statistic.iterations + 1 << ": curr = " << curr << ", prev = " << prev << ", gradient = " << grad << '\n';
+        #endif
+
+        if ((statistic.accuracy = distance(prev, curr)) < 2.0 * eps) {
+            if (fresh_factor) {
+                break;
+            }
+
+            // A reused factorization may overstate the curvature and shrink the step: 
+            // only accept convergence on a freshly computed one.
+            hessian_factor.compute(hessian(function_nd, prev));
+            statistic.function_probes += hessian_probes;
+            fresh_factor = true;
+            continue;
+        }
+
+        curr_grad = gradient(function_nd, curr);
+        statistic.function_probes += 2 * prev.size();
+
+        if (!fresh_factor && curr_grad.norm() > NEWTON_REUSE_RATIO * grad.norm()) {
+            // The stored factorization no longer describes the problem: refactor and retry the step.
+            hessian_factor.compute(hessian(function_nd, prev));
+            statistic.function_probes += hessian_probes;
+            fresh_factor = true;
+            continue;
+        }
+
+        fresh_factor = false;
+        grad = curr_grad;
+        prev = curr;
+    }
+
+    statistic.result = (prev + curr) * Scalar(0.5);
+    statistic.accuracy *= 0.5;
+
+    store(statistic.result, function_nd(statistic.result));
+    ++statistic.function_probes;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> solver_session_t<Scalar>::quasi_newton(
+    const function_nd_t<Scalar> function_nd, 
+    const Scalar eps, 
+    const uint64_t max_iterations
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called session quasi_newton method with parameters:\nstart = " << last_solution 
+        << ";\neps =" << eps << ";\nmax_iterations = " << max_iterations << '\n';
+    #endif
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::QUASI_NEWTON;
+
+    warm_start(function_nd, statistic.function_probes);
+
+    vector_t<Scalar> curr(last_solution), prev(last_solution), curr_grad, dir;
+    vector_t<Scalar> grad = gradient(function_nd, prev);
+    Scalar value = function_nd(prev), curr_value;
+    statistic.function_probes += 2 * prev.size() + 1;
+
+    uint64_t iteration;
+    for (iteration = 0; iteration != max_iterations; ++iteration) {
+        dir = -inverse_hessian_product(grad);
+
+        if (dir.dot(grad) >= 0) {
+            curvature_pairs.clear();
+            dir = -step_scale * grad;
+        }
+
+        curr = prev + dir;
+
+        #ifdef __DEBUG__
+            std::cout << "Iteration #" << iteration + 1 << ": curr = " << curr << ", prev = " << prev 
+            << ", curvature pairs = " << curvature_pairs.size() << '\n';
+        #endif
+
+        if ((statistic.accuracy = distance(prev, curr)) < 2.0 * eps) {
+            break;
+        }
+
+        curr_value = function_nd(curr);
+        ++statistic.function_probes;
+
+        // The full step is taken whenever it decreases the function enough (Armijo), otherwise it is searched.
+        if (curr_value > value + Scalar(ARMIJO_SLOPE) * grad.dot(dir)) {
+            auto sub_statistic = brent<Scalar>(function_nd, prev, curr, eps);
+
+            curr = sub_statistic.result;
+            curr_value = function_nd(curr);
+            statistic.iterations += sub_statistic.iterations;
+            statistic.function_probes += sub_statistic.function_probes + 1;
+        }
+
+        curr_grad = gradient(function_nd, curr);
+        statistic.function_probes += 2 * prev.size();
+
+        if (curvature_pairs.empty()) {
+            step_scale *= std::max(Scalar(2.0) * distance(prev, curr) / distance(prev, vector_t<Scalar>(prev + dir)), Scalar(0.1));
+        }
+
+        push_pair(curr - prev, curr_grad - grad);
+
+        statistic.accuracy = distance(prev, curr);
+
+        grad = curr_grad;
+        value = curr_value;
+        prev = curr;
+
+        if (statistic.accuracy < 2.0 * eps) {
+            break;
+        }
+    }
+
+    statistic.iterations += iteration;
+
+    statistic.result = prev;
+    statistic.accuracy *= 0.5;
+
+    store(prev, value);
+
+    return statistic;
+}
@@ -0,0 +1,309 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <Eigen/Dense>
+
+#include "common.h"
+#include "numerics.h"
+#include "dataset.h"
+#include "search_result_nd.h"
+#include "stochastic.h"
+
+namespace mo_optim_detail {
+    // Splits rows [begin, end) over at most `threads` workers, never giving one less than STOCHASTIC_MIN_CHUNK rows,
+    // and sums what chunk(from, to) returns for every part.
+    template <typename Result, typename Chunk>
+    inline Result parallel_reduce(const uint64_t begin, const uint64_t end, const uint32_t threads, Chunk chunk) {
+        const uint64_t count = end - begin;
+        const uint64_t workers = std::max<uint64_t>(1, std::min<uint64_t>(threads, count / STOCHASTIC_MIN_CHUNK));
+
+        if (workers == 1) {
+            return chunk(begin, end);
+        }
+
+        const uint64_t step = (count + workers - 1) / workers;
+
+        std::vector<std::future<Result>> parts;
+        for (uint64_t from = begin + step; from < end; from += step) {
+            parts.push_back(std::async(std::launch::async, chunk, from, std::min(end, from + step)));
+        }
+
+        Result result = chunk(begin, begin + step);
+        for (auto& part : parts) {
+            result += part.get();
+        }
+
+        return result;
+    }
+}
+
+template <typename Scalar>
+sum_objective_t<Scalar>::sum_objective_t(const mapped_dataset_t<Scalar>& dataset, term_type term, term_gradient_type term_gradient, const uint32_t threads) 
+    : dataset(dataset), term(term), term_gradient(term_gradient), threads(threads) {
+    if (this->threads == 0) {
+        this->threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+template <typename Scalar>
+Scalar sum_objective_t<Scalar>::value(const vector_t<Scalar>& x, const uint64_t begin, const uint64_t end, const bool parallel) const {
+    return mo_optim_detail::parallel_reduce<Scalar>(begin, end, parallel ? threads : 1, [this, &x](uint64_t from, uint64_t to) {
+        Scalar result = 0;
+        for (uint64_t row = from; row < to; ++row) {
+            result += term(x, record_t<Scalar>{&dataset, row});
+        }
+        return result;
+    });
+}
+
+template <typename Scalar>
+vector_t<Scalar> sum_objective_t<Scalar>::gradient(const vector_t<Scalar>& x, const uint64_t begin, const uint64_t end, const bool parallel) const {
+    return mo_optim_detail::parallel_reduce<vector_t<Scalar>>(begin, end, parallel ? threads : 1, [this, &x](uint64_t from, uint64_t to) {
+        vector_t<Scalar> grad = vector_t<Scalar>::Zero(x.size());
+
+        if (term_gradient) {
+            for (uint64_t row = from; row < to; ++row) {
+                term_gradient(x, record_t<Scalar>{&dataset, row}, grad);
+            }
+            return grad;
+        }
+
+        // All perturbations of one record are taken while it is in cache.
+        const Scalar dx = differential_step<Scalar>();
+        vector_t<Scalar> point(x);
+
+        for (uint64_t row = from; row < to; ++row) {
+            const record_t<Scalar> record{&dataset, row};
+
+            for (int i = 0; i < x.size(); ++i) {
+                point[i] = x[i] + dx;
+                Scalar y_1 = term(point, record);
+                point[i] = x[i] - dx;
+                Scalar y_2 = term(point, record);
+                point[i] = x[i];
+
+                grad[i] += (y_1 - y_2) / (Scalar(2.0) * dx);
+            }
+        }
+
+        return grad;
+    });
+}
+
+template <typename Scalar>
+void sum_objective_t<Scalar>::count_gradient(const uint64_t rows, const uint64_t dimension, search_result_nd_t<Scalar>& statistic) const {
+    if (term_gradient) {
+        statistic.gradient_evaluations += rows;
+    } else {
+        statistic.function_probes += 2 * dimension * rows;
+    }
+}
+
+namespace mo_optim_detail {
+    // Runs update(begin, end) over one epoch of shuffled batches, paging in the next batch meanwhile.
+    template <typename Scalar, typename Update>
+    inline void for_each_batch(const sum_objective_t<Scalar>& objective, const uint64_t batch_size, std::mt19937_64& random, Update update) {
+        const uint64_t rows = objective.dataset.rows();
+        const uint64_t batches = (rows + batch_size - 1) / batch_size;
+
+        std::vector<uint64_t> order(batches);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), random);
+
+        for (uint64_t batch = 0; batch < batches; ++batch) {
+            if (batch + 1 < batches) {
+                const uint64_t next = order[batch + 1] * batch_size;
+                objective.dataset.prefetch(next, std::min(rows, next + batch_size));
+            }
+
+            const uint64_t begin = order[batch] * batch_size;
+            update(begin, std::min(rows, begin + batch_size));
+        }
+    }
+
+    // Rejects arguments the batch loops cannot run with: an empty batch would divide by zero rows.
+    template <typename Scalar>
+    inline void check_batching(const sum_objective_t<Scalar>& objective, const uint64_t batch_size) {
+        if (batch_size == 0) {
+            throw std::invalid_argument("Batch size must be positive");
+        }
+
+        if (objective.threads == 0) {
+            throw std::invalid_argument("Thread count must be positive");
+        }
+    }
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> sgd_momentum(
+    const sum_objective_t<Scalar>& objective, 
+    const vector_t<Scalar>& start, 
+    const non_deduced_t<Scalar> learning_rate, 
+    const non_deduced_t<Scalar> momentum, 
+    const uint64_t batch_size, 
+    const uint64_t epochs, 
+    const non_deduced_t<Scalar> eps
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called stochastic sgd_momentum method with parameters:\nstart = " << start 
+        << ";\nlearning_rate = " << learning_rate << ";\nbatch_size = " << batch_size << ";\nepochs = " << epochs << '\n';
+    #endif
+
+    mo_optim_detail::check_batching(objective, batch_size);
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::SGD_MOMENTUM;
+
+    std::mt19937_64 random(STOCHASTIC_SEED);
+    vector_t<Scalar> x(start), prev(start), velocity = vector_t<Scalar>::Zero(start.size());
+
+    for (; statistic.epochs < epochs; ) {
+        mo_optim_detail::for_each_batch(objective, batch_size, random, [&](uint64_t begin, uint64_t end) {
+            velocity = momentum * velocity - (learning_rate / (end - begin)) * objective.gradient(x, begin, end);
+            x += velocity;
+
+            objective.count_gradient(end - begin, x.size(), statistic);
+            ++statistic.batches;
+        });
+
+        ++statistic.epochs;
+
+        #ifdef __DEBUG__
+            std::cout << "Epoch #" << statistic.epochs << ": x = " << x << '\n';
+        #endif
+
+        if ((statistic.accuracy = distance(prev, x)) < 2.0 * eps) {
+            break;
+        }
+
+        prev = x;
+    }
+
+    statistic.result = x;
+    statistic.accuracy *= 0.5;
+    statistic.iterations = statistic.batches;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> adam(
+    const sum_objective_t<Scalar>& objective, 
+    const vector_t<Scalar>& start, 
+    const non_deduced_t<Scalar> learning_rate, 
+    const uint64_t batch_size, 
+    const uint64_t epochs, 
+    const non_deduced_t<Scalar> eps
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called stochastic adam method with parameters:\nstart = " << start 
+        << ";\nlearning_rate = " << learning_rate << ";\nbatch_size = " << batch_size << ";\nepochs = " << epochs << '\n';
+    #endif
+
+    mo_optim_detail::check_batching(objective, batch_size);
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::ADAM;
+
+    const Scalar beta_1 = ADAM_BETA_1, beta_2 = ADAM_BETA_2;
+
+    std::mt19937_64 random(STOCHASTIC_SEED);
+    vector_t<Scalar> x(start), prev(start), grad;
+    vector_t<Scalar> moment_1 = vector_t<Scalar>::Zero(start.size()), moment_2 = vector_t<Scalar>::Zero(start.size());
+    Scalar decay_1 = 1, decay_2 = 1;
+
+    for (; statistic.epochs < epochs; ) {
+        mo_optim_detail::for_each_batch(objective, batch_size, random, [&](uint64_t begin, uint64_t end) {
+            grad = objective.gradient(x, begin, end) / Scalar(end - begin);
+
+            moment_1 = beta_1 * moment_1 + (1 - beta_1) * grad;
+            moment_2 = beta_2 * moment_2 + (1 - beta_2) * grad.cwiseAbs2();
+            decay_1 *= beta_1;
+            decay_2 *= beta_2;
+
+            x.array() -= learning_rate * (moment_1.array() / (1 - decay_1)) 
+                / ((moment_2.array() / (1 - decay_2)).sqrt() + Scalar(ADAM_EPSILON));
+
+            objective.count_gradient(end - begin, x.size(), statistic);
+            ++statistic.batches;
+        });
+
+        ++statistic.epochs;
+
+        #ifdef __DEBUG__
+            std::cout << "Epoch #" << statistic.epochs << ": x = " << x << '\n';
+        #endif
+
+        if ((statistic.accuracy = distance(prev, x)) < 2.0 * eps) {
+            break;
+        }
+
+        prev = x;
+    }
+
+    statistic.result = x;
+    statistic.accuracy *= 0.5;
+    statistic.iterations = statistic.batches;
+
+    return statistic;
+}
+
+template <typename Scalar>
+search_result_nd_t<Scalar> svrg(
+    const sum_objective_t<Scalar>& objective, 
+    const vector_t<Scalar>& start, 
+    const non_deduced_t<Scalar> learning_rate, 
+    const uint64_t batch_size, 
+    const uint64_t epochs, 
+    const non_deduced_t<Scalar> eps
+) {
+    #ifdef __DEBUG__
+        std::cout << "Called stochastic svrg method with parameters:\nstart = " << start 
+        << ";\nlearning_rate = " << learning_rate << ";\nbatch_size = " << batch_size << ";\nepochs = " << epochs << '\n';
+    #endif
+
+    mo_optim_detail::check_batching(objective, batch_size);
+
+    search_result_nd_t<Scalar> statistic;
+    statistic.type = search_method_type_nd::SVRG;
+
+    const uint64_t rows = objective.dataset.rows();
+
+    std::mt19937_64 random(STOCHASTIC_SEED);
+    vector_t<Scalar> x(start), snapshot, full_grad;
+
+    for (; statistic.epochs < epochs; ) {
+        snapshot = x;
+        full_grad = objective.gradient(snapshot, 0, rows) / Scalar(rows);
+        objective.count_gradient(rows, x.size(), statistic);
+
+        mo_optim_detail::for_each_batch(objective, batch_size, random, [&](uint64_t begin, uint64_t end) {
+            x -= learning_rate * ((objective.gradient(x, begin, end) - objective.gradient(snapshot, begin, end)) / Scalar(end - begin) + full_grad);
+
+            objective.count_gradient(2 * (end - begin), x.size(), statistic);
+            ++statistic.batches;
+        });
+
+        ++statistic.epochs;
+
+        #ifdef __DEBUG__
+            std::cout << "Epoch #" << statistic.epochs << ": x = " << x << '\n';
+        #endif
+
+        if ((statistic.accuracy = distance(snapshot, x)) < 2.0 * eps) {
+            break;
+        }
+    }
+
+    statistic.result = x;
+    statistic.accuracy *= 0.5;
+    statistic.iterations = statistic.batches;
+
+    return statistic;
+}
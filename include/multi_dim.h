@@ -1,58 +1,124 @@
 #pragma once
 #include <Eigen/Dense>
 #include "common.h"
+#include "numerics.h"
 #include "search_result_nd.h"
 
-search_result_nd bisect(
-    const std::function<double(const Eigen::VectorXd)> function_nd, 
-    const Eigen::VectorXd& left, 
-    const Eigen::VectorXd& right, 
-    const double eps=N_DIM_ACCURACY, 
+// Scalar defaults to double. Points and bounds are not deduced from, so Eigen expressions and fixed size
+// vectors convert to vector_t; other precisions are selected explicitly, e.g. newtone_raphson<float>(...).
+template <typename Scalar = double>
+search_result_nd_t<Scalar> bisect(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& left, 
+    const non_deduced_t<vector_t<Scalar>>& right, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY, 
     const uint64_t max_iterations=N_DIM_ITERS_MAX
 );
 
 
-search_result_nd golden_ratio(
-    const std::function<double(const Eigen::VectorXd)> function_nd, 
-    const Eigen::VectorXd& left, 
-    const Eigen::VectorXd& right, 
-    const double eps=N_DIM_ACCURACY, 
+template <typename Scalar = double>
+search_result_nd_t<Scalar> golden_ratio(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& left, 
+    const non_deduced_t<vector_t<Scalar>>& right, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY, 
     const uint64_t max_iterations=N_DIM_ITERS_MAX
 );
 
 
-search_result_nd fibonacchi(
-    const std::function<double(const Eigen::VectorXd)> function_nd, 
-    const Eigen::VectorXd& left, 
-    const Eigen::VectorXd& right, 
-    const double eps=N_DIM_ACCURACY
+template <typename Scalar = double>
+search_result_nd_t<Scalar> fibonacchi(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& left, 
+    const non_deduced_t<vector_t<Scalar>>& right, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY
 );
 
-search_result_nd per_coord_descend(
-    const std::function<double(const Eigen::VectorXd)> function_nd, 
-    const Eigen::VectorXd& start,
-    const double step=PER_COORD_DESCEND_STEP, 
-    const double eps=N_DIM_ACCURACY, 
+template <typename Scalar = double>
+search_result_nd_t<Scalar> brent(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& left, 
+    const non_deduced_t<vector_t<Scalar>>& right, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY, 
     const uint64_t max_iterations=N_DIM_ITERS_MAX
 );
 
-search_result_nd gradient_descend(
-    const std::function<double(const Eigen::VectorXd)> function_nd, 
-    const Eigen::VectorXd& start, 
-    const double eps=N_DIM_ACCURACY, 
+// line_search_type selects the one dimensional method used along each descend direction;
+// ND_BRENT brackets the whole ray first, so the step is not limited to the initial segment; when no
+// minimum is enclosed it falls back to ND_FIBONACCHI on the initial segment.
+template <typename Scalar = double>
+search_result_nd_t<Scalar> per_coord_descend(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& start,
+    const non_deduced_t<Scalar> step=PER_COORD_DESCEND_STEP, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY, 
+    const uint64_t max_iterations=N_DIM_ITERS_MAX,
+    const search_method_type_nd line_search_type=ND_FIBONACCHI
+);
+
+template <typename Scalar = double>
+search_result_nd_t<Scalar> gradient_descend(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& start, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY, 
+    const uint64_t max_iterations=N_DIM_ITERS_MAX,
+    const search_method_type_nd line_search_type=ND_FIBONACCHI
+);
+
+template <typename Scalar = double>
+search_result_nd_t<Scalar> conj_gradient_descend(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& start, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY, 
+    const uint64_t max_iterations=N_DIM_ITERS_MAX,
+    const search_method_type_nd line_search_type=ND_FIBONACCHI
+);
+
+template <typename Scalar = double>
+search_result_nd_t<Scalar> newtone_raphson(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& start, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY, 
     const uint64_t max_iterations=N_DIM_ITERS_MAX
 );
 
-search_result_nd conj_gradient_descend(
-    const std::function<double(const Eigen::VectorXd)> function_nd, 
-    const Eigen::VectorXd& start, 
-    const double eps=N_DIM_ACCURACY, 
+// Box constrained variants: iterates stay inside [lower, upper], and coordinates held on a bound
+// drop out of gradient and Hessian evaluation until a full gradient check releases them.
+template <typename Scalar = double>
+search_result_nd_t<Scalar> projected_gradient_descend(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& start, 
+    const non_deduced_t<vector_t<Scalar>>& lower, 
+    const non_deduced_t<vector_t<Scalar>>& upper, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY, 
+    const uint64_t max_iterations=N_DIM_ITERS_MAX,
+    const search_method_type_nd line_search_type=ND_FIBONACCHI
+);
+
+template <typename Scalar = double>
+search_result_nd_t<Scalar> projected_newtone_raphson(
+    const non_deduced_t<function_nd_t<Scalar>> function_nd, 
+    const non_deduced_t<vector_t<Scalar>>& start, 
+    const non_deduced_t<vector_t<Scalar>>& lower, 
+    const non_deduced_t<vector_t<Scalar>>& upper, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY, 
     const uint64_t max_iterations=N_DIM_ITERS_MAX
 );
 
-search_result_nd newtone_raphson(
-    const std::function<double(const Eigen::VectorXd)> function_nd, 
-    const Eigen::VectorXd& start, 
-    const double eps=N_DIM_ACCURACY, 
+// Runs method in the Low precision until its step falls below the precision's own resolution 
+// (never below eps), then always polishes the result in High precision down to eps. Each stage 
+// gets its own max_iterations budget.
+// Precisions are given explicitly and High defaults to double, e.g. mixed_precision<float>(function_float, function_double, start, NEWTONE_RAPHSON).
+template <typename Low, typename High = double>
+search_result_nd_t<High> mixed_precision(
+    const non_deduced_t<function_nd_t<Low>> function_nd_low, 
+    const non_deduced_t<function_nd_t<High>> function_nd, 
+    const non_deduced_t<vector_t<High>>& start, 
+    const search_method_type_nd method, 
+    const non_deduced_t<High> eps=N_DIM_ACCURACY, 
     const uint64_t max_iterations=N_DIM_ITERS_MAX
-);
\ No newline at end of file
+);
+
+#ifdef MO_OPTIM_HEADER_ONLY
+#include "impl/multi_dim.ipp"
+#endif
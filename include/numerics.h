@@ -1,29 +1,95 @@
+#pragma once
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <cmath>
+#include <vector>
 #include <Eigen/Dense>
+#include "common.h"
 
-Eigen::VectorXd direction(const Eigen::VectorXd& left, const Eigen::VectorXd& right);
+template <typename Scalar>
+using vector_t = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
 
-double partial(std::function<double(const Eigen::VectorXd)> function_nd, Eigen::VectorXd& point, uint32_t index);
+template <typename Scalar>
+using matrix_t = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
 
-double partial2(std::function<double(const Eigen::VectorXd)> function_nd, Eigen::VectorXd& point, uint32_t index1, uint32_t index2);
+template <typename Scalar>
+using function_nd_t = std::function<Scalar(const vector_t<Scalar>)>;
 
-Eigen::VectorXd gradient(std::function<double(const Eigen::VectorXd)> function_nd, Eigen::VectorXd& point);
+// Central difference step: double keeps the historical DX, other types scale it with their machine epsilon.
+template <typename Scalar>
+inline Scalar differential_step() {
+    return std::cbrt(std::numeric_limits<Scalar>::epsilon());
+}
+
+template <>
+inline double differential_step<double>() {
+    return DX;
+}
+
+template <typename Scalar>
+vector_t<Scalar> direction(const vector_t<Scalar>& left, const vector_t<Scalar>& right);
+
+template <typename Scalar>
+Scalar partial(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, uint32_t index);
+
+template <typename Scalar>
+Scalar partial2(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, uint32_t index1, uint32_t index2);
+
+template <typename Scalar>
+vector_t<Scalar> gradient(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point);
+
+template <typename Scalar>
+matrix_t<Scalar> hessian(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point);
 
-Eigen::MatrixXd hessian(std::function<double(const Eigen::VectorXd)> function_nd, Eigen::VectorXd& point);
+// Second derivatives over the listed coordinates only, as a coords.size() square matrix.
+template <typename Scalar>
+matrix_t<Scalar> hessian(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, const std::vector<uint32_t>& coords);
 
-double distance(const Eigen::VectorXd& left, const Eigen::VectorXd& right);
+// Same differences taken within the box [lower, upper]: one-sided toward the interior where a central 
+// step would leave the box, central elsewhere (and wherever the box leaves no room on either side).
+template <typename Scalar>
+Scalar partial(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, uint32_t index, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper);
 
-void custom_vector_print(std::ostream& out, const Eigen::VectorXd& vec);
+template <typename Scalar>
+Scalar partial2(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, uint32_t index1, uint32_t index2, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper);
 
-std::ostream& operator<<(std::ostream& stream, const Eigen::VectorXd& vec);
+template <typename Scalar>
+vector_t<Scalar> gradient(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper);
 
-inline void fib_next(double& fib_1, double& fib_2) {
-    const double fib_temp(fib_1);
+template <typename Scalar>
+matrix_t<Scalar> hessian(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, const std::vector<uint32_t>& coords, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper);
+
+// Clamps point into the box [lower, upper].
+template <typename Scalar>
+vector_t<Scalar> project(const vector_t<Scalar>& point, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper);
+
+// Coordinates not held on a bound by a gradient pointing out of the box.
+template <typename Scalar>
+std::vector<uint32_t> free_coords(const vector_t<Scalar>& point, const vector_t<Scalar>& grad, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper);
+
+template <typename Scalar>
+Scalar distance(const vector_t<Scalar>& left, const vector_t<Scalar>& right);
+
+template <typename Scalar>
+std::ostream& operator<<(std::ostream& stream, const vector_t<Scalar>& vec);
+
+// Fibonacci counters are kept integral whatever the Scalar, only their ratios are taken in Scalar.
+inline void fib_next(uint64_t& fib_1, uint64_t& fib_2) {
+    const uint64_t fib_temp(fib_1);
     fib_1 = fib_2;
     fib_2 += fib_temp;
 }
 
-inline void fib_prev(double& fib_1, double& fib_2) {
-    const double fib_temp(fib_2 - fib_1);
+inline void fib_prev(uint64_t& fib_1, uint64_t& fib_2) {
+    const uint64_t fib_temp(fib_2 - fib_1);
     fib_2 = fib_1;
     fib_1 = fib_temp;
-}
\ No newline at end of file
+}
+
+// Largest fib_2 that fib_next can still advance without overflow.
+constexpr uint64_t FIB_LIMIT = std::numeric_limits<uint64_t>::max() / 2;
+
+#ifdef MO_OPTIM_HEADER_ONLY
+#include "impl/numerics.ipp"
+#endif
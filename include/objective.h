@@ -0,0 +1,101 @@
+#pragma once
+#include <type_traits>
+#include <utility>
+#include <Eigen/Dense>
+#include "common.h"
+#include "numerics.h"
+#include "search_result_nd.h"
+
+// Objectives that know their own gradient. Any type providing
+//     Scalar value(const vector_t<Scalar>& x) const;
+//     Scalar value_and_gradient(const vector_t<Scalar>& x, vector_t<Scalar>& grad) const;
+// and optionally
+//     vector_t<Scalar> hessian_vector_product(const vector_t<Scalar>& x, const vector_t<Scalar>& v) const;
+// is picked up by the overloads below instead of the finite difference solvers of multi_dim.h.
+// Plain functions and lambdas keep resolving to the finite difference versions.
+
+// Kept out of the global namespace, where it would clash with std::void_t under using namespace std.
+namespace mo_optim_detail {
+    template <typename...>
+    struct make_void {
+        using type = void;
+    };
+
+    template <typename... Types>
+    using void_t = typename make_void<Types...>::type;
+}
+
+template <typename Objective, typename Scalar, typename = void>
+struct has_value_and_gradient : std::false_type {};
+
+template <typename Objective, typename Scalar>
+struct has_value_and_gradient<Objective, Scalar, mo_optim_detail::void_t<
+    decltype(Scalar(std::declval<const Objective&>().value(std::declval<const vector_t<Scalar>&>()))),
+    decltype(Scalar(std::declval<const Objective&>().value_and_gradient(
+        std::declval<const vector_t<Scalar>&>(), std::declval<vector_t<Scalar>&>()
+    )))
+>> : std::true_type {};
+
+template <typename Objective, typename Scalar, typename = void>
+struct has_hessian_vector_product : std::false_type {};
+
+template <typename Objective, typename Scalar>
+struct has_hessian_vector_product<Objective, Scalar, mo_optim_detail::void_t<
+    decltype(vector_t<Scalar>(std::declval<const Objective&>().hessian_vector_product(
+        std::declval<const vector_t<Scalar>&>(), std::declval<const vector_t<Scalar>&>()
+    )))
+>> : std::true_type {};
+
+template <typename Objective, typename Scalar>
+using enable_if_fused_t = typename std::enable_if<has_value_and_gradient<Objective, Scalar>::value>::type;
+
+// Scalar of an objective, read off its value() member. The fused solvers take their Scalar from here
+// rather than deducing it from start, so start may be any expression convertible to the objective's vector.
+template <typename Value>
+struct objective_scalar {};
+
+template <typename Class, typename Scalar>
+struct objective_scalar<Scalar (Class::*)(const vector_t<Scalar>&) const> {
+    using type = Scalar;
+};
+
+template <typename Class, typename Scalar>
+struct objective_scalar<Scalar (Class::*)(vector_t<Scalar>) const> {
+    using type = Scalar;
+};
+
+template <typename Objective>
+using objective_scalar_t = typename objective_scalar<decltype(&Objective::value)>::type;
+
+// Steps are chosen by Armijo backtracking, so every accepted point already carries its gradient.
+// function_probes counts value() calls only; gradient_evaluations and hessian_vector_products
+// count the fused calls.
+template <typename Objective, typename Scalar = objective_scalar_t<Objective>, typename = enable_if_fused_t<Objective, Scalar>>
+search_result_nd_t<Scalar> gradient_descend(
+    const Objective& objective,
+    const non_deduced_t<vector_t<Scalar>>& start,
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY,
+    const uint64_t max_iterations=N_DIM_ITERS_MAX
+);
+
+// Polak-Ribiere+ directions, restarted every start.size() iterations or when not a descend direction.
+template <typename Objective, typename Scalar = objective_scalar_t<Objective>, typename = enable_if_fused_t<Objective, Scalar>>
+search_result_nd_t<Scalar> conj_gradient_descend(
+    const Objective& objective,
+    const non_deduced_t<vector_t<Scalar>>& start,
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY,
+    const uint64_t max_iterations=N_DIM_ITERS_MAX
+);
+
+// With hessian_vector_product the Newton system is solved by conjugate gradients (no Hessian is formed);
+// without it the Hessian is taken by central differences of 2 * start.size() gradients.
+template <typename Objective, typename Scalar = objective_scalar_t<Objective>, typename = enable_if_fused_t<Objective, Scalar>>
+search_result_nd_t<Scalar> newtone_raphson(
+    const Objective& objective,
+    const non_deduced_t<vector_t<Scalar>>& start,
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY,
+    const uint64_t max_iterations=N_DIM_ITERS_MAX
+);
+
+// Templated on the objective type, so always compiled in the including translation unit.
+#include "impl/objective.ipp"
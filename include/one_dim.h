@@ -1,7 +1,28 @@
 #pragma once
+#include <functional>
 #include "common.h"
 #include "search_result.h"
 
-search_result bisect(const std::function<double(double)> function, double left, double right, const double eps=ACCURACY, const uint64_t max_iterations=ITERS_MAX);
-search_result golden_ratio(const std::function<double(double)> function, double left, double right, const double eps=ACCURACY, const uint64_t max_iterations=ITERS_MAX);
-search_result fibonacchi(const std::function<double(double)> function, double left, double right, const double eps=ACCURACY);
\ No newline at end of file
+template <typename Scalar>
+using function_t = std::function<Scalar(Scalar)>;
+
+// Scalar defaults to double and is never deduced from the bounds, so golden_ratio(function, -1, 1) searches in double.
+
+template <typename Scalar = double>
+search_result_t<Scalar> bisect(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar> left, non_deduced_t<Scalar> right, const non_deduced_t<Scalar> eps=ACCURACY, const uint64_t max_iterations=ITERS_MAX);
+template <typename Scalar = double>
+search_result_t<Scalar> golden_ratio(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar> left, non_deduced_t<Scalar> right, const non_deduced_t<Scalar> eps=ACCURACY, const uint64_t max_iterations=ITERS_MAX);
+template <typename Scalar = double>
+search_result_t<Scalar> fibonacchi(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar> left, non_deduced_t<Scalar> right, const non_deduced_t<Scalar> eps=ACCURACY);
+
+// Expands from start by golden/parabolic extrapolation until [left, right] encloses a minimum.
+// The result type is NONE when no minimum was enclosed within max_iterations.
+template <typename Scalar = double>
+search_result_t<Scalar> bracket(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar>& left, non_deduced_t<Scalar>& right, const non_deduced_t<Scalar> start=0.0, const non_deduced_t<Scalar> step=BRACKET_STEP, const uint64_t max_iterations=ITERS_MAX);
+// Parabolic interpolation safeguarded by golden section steps; [left, right] must bracket a minimum.
+template <typename Scalar = double>
+search_result_t<Scalar> brent(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar> left, non_deduced_t<Scalar> right, const non_deduced_t<Scalar> eps=ACCURACY, const uint64_t max_iterations=ITERS_MAX);
+
+#ifdef MO_OPTIM_HEADER_ONLY
+#include "impl/one_dim.ipp"
+#endif
@@ -7,21 +7,24 @@ enum search_method_type {
     BISECT,
     GOLDEN_RATIO,
     FIBONACCHI,
-    NONE
+    NONE,
+    BRACKET,
+    BRENT
 };
 
-const auto search_method_string = {"Bisection", "Golden ratio", "Fibonacchi", "None"};
+const auto search_method_string = {"Bisection", "Golden ratio", "Fibonacchi", "None", "Bracket", "Brent"};
 
-struct search_result {
+template <typename Scalar>
+struct search_result_t {
     search_method_type type;
-    double result;
-    double accuracy;
+    Scalar result;
+    Scalar accuracy;
     uint64_t iterations;
     uint64_t function_probes;
 
-    search_result() : type(search_method_type::NONE), result(0.0), accuracy(0.0), iterations(0), function_probes(0) {}
+    search_result_t() : type(search_method_type::NONE), result(0.0), accuracy(0.0), iterations(0), function_probes(0) {}
 
-    search_result(search_method_type type, double result, double accuracy, uint64_t iterations, uint64_t function_probes) {
+    search_result_t(search_method_type type, Scalar result, Scalar accuracy, uint64_t iterations, uint64_t function_probes) {
         this->type = type;
         this->result = result;
         this->accuracy = accuracy;
@@ -30,4 +33,11 @@ struct search_result {
     }
 };
 
-std::ostream& operator<<(std::ostream& stream, const search_result& statistic);
\ No newline at end of file
+using search_result = search_result_t<double>;
+
+template <typename Scalar>
+std::ostream& operator<<(std::ostream& stream, const search_result_t<Scalar>& statistic);
+
+#ifdef MO_OPTIM_HEADER_ONLY
+#include "impl/search_result.ipp"
+#endif
@@ -3,6 +3,7 @@
 #include <cstdlib>
 #include <iostream>
 #include "common.h"
+#include "numerics.h"
 
 enum search_method_type_nd {
     ND_BISECT,
@@ -12,31 +13,58 @@ enum search_method_type_nd {
     GRADIENT_DESCEND,
     CONJ_GRADIENT_DESCEND,
     NEWTONE_RAPHSON,
-    ND_NONE
+    ND_NONE,
+    ND_BRENT,
+    PROJECTED_GRADIENT_DESCEND,
+    PROJECTED_NEWTONE_RAPHSON,
+    QUASI_NEWTON,
+    SGD_MOMENTUM,
+    ADAM,
+    SVRG
 };
 
 const auto search_method_string_nd = {
     "Bisection", "Golden ratio", "Fibonacchi", 
     "Per coordinate descend", "Gradient descend", "Conjugate gradient descend", 
-    "Newtone Raphson", "None"
+    "Newtone Raphson", "None", "Brent", "Projected gradient descend", 
+    "Projected Newtone Raphson", "Quasi Newton", "SGD with momentum", "Adam", "SVRG"
 };
 
-struct search_result_nd {
+template <typename Scalar>
+struct search_result_nd_t {
     search_method_type_nd type;
-    Eigen::VectorXd result;
-    double accuracy;
+    vector_t<Scalar> result;
+    Scalar accuracy;
     uint64_t iterations;
     uint64_t function_probes;
+    // Analytic gradients (value_and_gradient, term_gradient) and hessian_vector_product calls, counted apart from plain value probes.
+    uint64_t gradient_evaluations;
+    uint64_t hessian_vector_products;
+    // Passes over the dataset and mini-batches processed; only stochastic methods set them.
+    uint64_t epochs;
+    uint64_t batches;
 
-    search_result_nd() : type(search_method_type_nd::ND_NONE), result(), accuracy(0.0), iterations(0), function_probes(0) {}
+    search_result_nd_t() : type(search_method_type_nd::ND_NONE), result(), accuracy(0.0), iterations(0), function_probes(0), 
+        gradient_evaluations(0), hessian_vector_products(0), epochs(0), batches(0) {}
 
-    search_result_nd(search_method_type_nd type, Eigen::VectorXd result, double accuracy, uint64_t iterations, uint64_t function_probes) {
+    search_result_nd_t(search_method_type_nd type, vector_t<Scalar> result, Scalar accuracy, uint64_t iterations, uint64_t function_probes) {
         this->type = type;
         this->result = result;
         this->accuracy = accuracy;
         this->iterations = iterations;
         this->function_probes = function_probes;
+        this->gradient_evaluations = 0;
+        this->hessian_vector_products = 0;
+        this->epochs = 0;
+        this->batches = 0;
     }
 };
 
-std::ostream& operator<<(std::ostream& stream, const search_result_nd& statistic);
\ No newline at end of file
+using search_result_nd = search_result_nd_t<double>;
+
+template <typename Scalar>
+std::ostream& operator<<(std::ostream& stream, const search_result_nd_t<Scalar>& statistic);
+
+#ifdef MO_OPTIM_HEADER_ONLY
+#include "impl/search_result_nd.ipp"
+#endif
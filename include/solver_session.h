@@ -0,0 +1,73 @@
+#pragma once
+#include <deque>
+#include <utility>
+#include <Eigen/Dense>
+#include "common.h"
+#include "numerics.h"
+#include "search_result_nd.h"
+
+// Carries state between solves of a sequence of related problems (parameter sweeps, recalibration):
+// the last solution, the last Hessian factorization, quasi Newton curvature pairs and the step scale.
+// Every solve warm starts from them; when the objective at the stored solution has moved by more than
+// drift_tolerance (relative), the cached curvature is dropped and only the solution is reused.
+template <typename Scalar>
+class solver_session_t {
+public:
+    explicit solver_session_t(const vector_t<Scalar>& start, const Scalar drift_tolerance=SESSION_DRIFT_TOLERANCE);
+
+    search_result_nd_t<Scalar> gradient_descend(
+        const function_nd_t<Scalar> function_nd, 
+        const Scalar eps=N_DIM_ACCURACY, 
+        const uint64_t max_iterations=N_DIM_ITERS_MAX
+    );
+
+    search_result_nd_t<Scalar> conj_gradient_descend(
+        const function_nd_t<Scalar> function_nd, 
+        const Scalar eps=N_DIM_ACCURACY, 
+        const uint64_t max_iterations=N_DIM_ITERS_MAX
+    );
+
+    // Reuses the stored Hessian factorization until it stops halving the gradient norm.
+    search_result_nd_t<Scalar> newtone_raphson(
+        const function_nd_t<Scalar> function_nd, 
+        const Scalar eps=N_DIM_ACCURACY, 
+        const uint64_t max_iterations=N_DIM_ITERS_MAX
+    );
+
+    // Limited memory BFGS; keeps the last SESSION_HISTORY curvature pairs across solves.
+    search_result_nd_t<Scalar> quasi_newton(
+        const function_nd_t<Scalar> function_nd, 
+        const Scalar eps=N_DIM_ACCURACY, 
+        const uint64_t max_iterations=N_DIM_ITERS_MAX
+    );
+
+    // Forgets everything but the new start point.
+    void reset(const vector_t<Scalar>& start);
+
+    const vector_t<Scalar>& solution() const { return last_solution; }
+    bool drifted() const { return last_drifted; }
+
+private:
+    void warm_start(const function_nd_t<Scalar>& function_nd, uint64_t& function_probes);
+    void store(const vector_t<Scalar>& solution, const Scalar value);
+    vector_t<Scalar> inverse_hessian_product(const vector_t<Scalar>& grad) const;
+    void push_pair(const vector_t<Scalar>& step, const vector_t<Scalar>& grad_step);
+
+    vector_t<Scalar> last_solution;
+    Scalar last_value;
+    bool has_value;
+    bool last_drifted;
+
+    Eigen::LDLT<matrix_t<Scalar>> hessian_factor;
+    bool has_hessian;
+
+    std::deque<std::pair<vector_t<Scalar>, vector_t<Scalar>>> curvature_pairs;
+    Scalar step_scale;
+    Scalar drift_tolerance;
+};
+
+using solver_session = solver_session_t<double>;
+
+#ifdef MO_OPTIM_HEADER_ONLY
+#include "impl/solver_session.ipp"
+#endif
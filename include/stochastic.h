@@ -0,0 +1,77 @@
+#pragma once
+#include <functional>
+#include <Eigen/Dense>
+#include "common.h"
+#include "numerics.h"
+#include "dataset.h"
+#include "search_result_nd.h"
+
+// Objective of the form f(x) = sum over records r of term(x, r).
+// term_gradient is optional and adds the gradient of one term to grad; without it gradients are
+// taken by central differences over the batch. With parallel set, rows are reduced over `threads` workers
+// (0 = all cores), each taking at least STOCHASTIC_MIN_CHUNK rows, so small mini-batches stay on one thread.
+template <typename Scalar>
+struct sum_objective_t {
+    using term_type = std::function<Scalar(const vector_t<Scalar>& x, const record_t<Scalar>& record)>;
+    using term_gradient_type = std::function<void(const vector_t<Scalar>& x, const record_t<Scalar>& record, vector_t<Scalar>& grad)>;
+
+    const mapped_dataset_t<Scalar>& dataset;
+    term_type term;
+    term_gradient_type term_gradient;
+    uint32_t threads;
+
+    sum_objective_t(const mapped_dataset_t<Scalar>& dataset, term_type term, term_gradient_type term_gradient=nullptr, const uint32_t threads=0);
+
+    // Sum of the terms of rows [begin, end).
+    Scalar value(const vector_t<Scalar>& x, const uint64_t begin, const uint64_t end, const bool parallel=true) const;
+
+    // Sum of the term gradients of rows [begin, end).
+    vector_t<Scalar> gradient(const vector_t<Scalar>& x, const uint64_t begin, const uint64_t end, const bool parallel=true) const;
+
+    // Adds what gradient() spends on a batch of the given number of rows to statistic: term_gradient 
+    // calls to gradient_evaluations, or the term evaluations of central differences to function_probes.
+    void count_gradient(const uint64_t rows, const uint64_t dimension, search_result_nd_t<Scalar>& statistic) const;
+};
+
+using sum_objective = sum_objective_t<double>;
+
+// Mini-batch methods over shuffled contiguous row ranges; the next batch is prefetched while the
+// current one is processed. Stops after `epochs` passes or when an epoch moves x by less than 2 * eps.
+// function_probes counts term evaluations, gradient_evaluations term_gradient calls and iterations
+// the parameter updates.
+// A zero batch_size or objective.threads throws std::invalid_argument.
+template <typename Scalar>
+search_result_nd_t<Scalar> sgd_momentum(
+    const sum_objective_t<Scalar>& objective, 
+    const vector_t<Scalar>& start, 
+    const non_deduced_t<Scalar> learning_rate=SGD_LEARNING_RATE, 
+    const non_deduced_t<Scalar> momentum=SGD_MOMENTUM_FACTOR, 
+    const uint64_t batch_size=STOCHASTIC_BATCH_SIZE, 
+    const uint64_t epochs=STOCHASTIC_EPOCHS, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY
+);
+
+template <typename Scalar>
+search_result_nd_t<Scalar> adam(
+    const sum_objective_t<Scalar>& objective, 
+    const vector_t<Scalar>& start, 
+    const non_deduced_t<Scalar> learning_rate=ADAM_LEARNING_RATE, 
+    const uint64_t batch_size=STOCHASTIC_BATCH_SIZE, 
+    const uint64_t epochs=STOCHASTIC_EPOCHS, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY
+);
+
+// Stochastic variance reduced gradient: one full gradient per epoch corrects every batch gradient.
+template <typename Scalar>
+search_result_nd_t<Scalar> svrg(
+    const sum_objective_t<Scalar>& objective, 
+    const vector_t<Scalar>& start, 
+    const non_deduced_t<Scalar> learning_rate=SGD_LEARNING_RATE, 
+    const uint64_t batch_size=STOCHASTIC_BATCH_SIZE, 
+    const uint64_t epochs=STOCHASTIC_EPOCHS, 
+    const non_deduced_t<Scalar> eps=N_DIM_ACCURACY
+);
+
+#ifdef MO_OPTIM_HEADER_ONLY
+#include "impl/stochastic.ipp"
+#endif
@@ -0,0 +1,7 @@
+#include "dataset.h"
+#include "impl/dataset.ipp"
+
+#define INSTANTIATE_DATASET(Scalar) \
+    template class mapped_dataset_t<Scalar>;
+
+INSTANTIATE_FOR_SCALARS(INSTANTIATE_DATASET)
@@ -6,6 +6,7 @@
 #include "multi_dim.h"
 #include "common.h"
 #include "numerics.h"
+#include "solver_session.h"
 
 double test_func(const double x)
 {
@@ -17,6 +18,12 @@ double test_func_2(const Eigen::VectorXd& x)
 	return (x[0] - 5) * x[0] + (x[1] - 3) * x[1]; //[2.5, 1.5]
 }
 
+template <typename Scalar>
+Scalar test_func_3(const vector_t<Scalar>& x)
+{
+	return (1 - x[0]) * (1 - x[0]) + 10 * (x[1] - x[0] * x[0]) * (x[1] - x[0] * x[0]); //[1, 1]
+}
+
 void lab1(const std::function<double(double)> function) {
     double x0 = 0;
     double x1 = 10;
@@ -24,6 +31,10 @@ void lab1(const std::function<double(double)> function) {
     std::cout << bisect(function, x0, x1) << '\n';
     std::cout << golden_ratio(function, x0, x1) << '\n';
     std::cout << fibonacchi(function, x0, x1, ACCURACY + 2e-7) << '\n';
+
+    double left, right;
+    std::cout << bracket(function, left, right, x0) << '\n';
+    std::cout << brent(function, left, right) << '\n';
 }
 
 void lab2(std::function<double(const Eigen::VectorXd&)> function_nd) {
@@ -48,13 +59,55 @@ void lab3(std::function<double(const Eigen::VectorXd&)> function_nd) {
 
     std::cout << gradient_descend(function_nd, start) << '\n';
     std::cout << conj_gradient_descend(function_nd, start) << '\n';
+    std::cout << gradient_descend(function_nd, start, N_DIM_ACCURACY, N_DIM_ITERS_MAX, ND_BRENT) << '\n';
+    std::cout << conj_gradient_descend(function_nd, start, N_DIM_ACCURACY, N_DIM_ITERS_MAX, ND_BRENT) << '\n';
     std::cout << newtone_raphson(function_nd, start) << '\n';
 }
 
+void lab4() {
+    vector_t<double> start(2);
+    start << -1.2, 1.0;
+
+    std::cout << newtone_raphson<float>(test_func_3<float>, start.cast<float>()) << '\n';
+    std::cout << newtone_raphson<double>(test_func_3<double>, start) << '\n';
+    std::cout << mixed_precision<float>(test_func_3<float>, test_func_3<double>, start, NEWTONE_RAPHSON, 1e-9) << '\n';
+    std::cout << mixed_precision<double, long double>(test_func_3<double>, test_func_3<long double>, start.cast<long double>(), NEWTONE_RAPHSON, 1e-12) << '\n';
+}
+
+void lab5(std::function<double(const Eigen::VectorXd&)> function_nd) {
+    Eigen::VectorXd start(2), lower(2), upper(2);
+    start << -14, -33.98;
+    lower << 0.0, 0.0;
+    upper << 2.0, 4.0; //[2, 1.5]
+
+    std::cout << projected_gradient_descend(function_nd, start, lower, upper) << '\n';
+    std::cout << projected_gradient_descend(function_nd, start, lower, upper, N_DIM_ACCURACY, N_DIM_ITERS_MAX, ND_BRENT) << '\n';
+    std::cout << projected_newtone_raphson(function_nd, start, lower, upper) << '\n';
+}
+
+void lab6() {
+    Eigen::VectorXd start(2);
+    start << -14, -33.98;
+
+    solver_session session(start);
+
+    for (double shift = 0.0; shift < 0.5; shift += 0.1) {
+        auto function_nd = [shift](const Eigen::VectorXd x) {
+            return (x[0] - 5 - shift) * x[0] + (x[1] - 3) * x[1] + 0.1 * x[0] * x[0] * x[1] * x[1]; 
+        };
+
+        std::cout << newtone_raphson(function_nd, start) << '\n';
+        std::cout << session.newtone_raphson(function_nd) << '\n';
+    }
+}
+
 int main() {
     //lab1(test_func);
     lab2(test_func_2);
     //lab3(test_func_2);
+    //lab4();
+    //lab5(test_func_2);
+    //lab6();
     
 
     return 0;
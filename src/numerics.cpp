@@ -1,78 +1,20 @@
-#include <iostream>
-#include <Eigen/Dense>
-
-#include "common.h"
 #include "numerics.h"
-
-Eigen::VectorXd direction(const Eigen::VectorXd& left, const Eigen::VectorXd& right) {
-    if (left.size() != right.size()) {
-        throw std::runtime_error("Dimensions of vectors are not equal");
-    }
-
-    return (right - left).normalized();
-}
-
-double partial(std::function<double(const Eigen::VectorXd)> function_nd, Eigen::VectorXd& point, uint32_t index) {
-    if (index >= point.size()) {
-        throw std::runtime_error("Index value is out of vector indices range");
-    }
-
-    point[index] += DX;
-    double y_1 = function_nd(point);
-    point[index] -= 2.0 * DX;
-    double y_2 = function_nd(point);
-    point[index] += DX;
-
-    return ((y_1 - y_2) / (2.0 * DX));
-}
-
-double partial2(std::function<double(const Eigen::VectorXd)> function_nd, Eigen::VectorXd& point, uint32_t index1, uint32_t index2) {
-    if (index2 >= point.size()) {
-        throw std::runtime_error("Index value is out of vector indices range");
-    }
-    point[index2] += DX;
-    double y_1 = partial(function_nd, point, index1);
-    point[index2] -= 2.0 * DX;
-    double y_2 = partial(function_nd, point, index1);
-    point[index2] += DX;
-
-    return ((y_1 - y_2) / (2.0 * DX));
-}
-
-Eigen::VectorXd gradient(std::function<double(const Eigen::VectorXd)> function_nd, Eigen::VectorXd& point) {
-    Eigen::VectorXd grad(point.size());
-
-    for (int i = 0; i < grad.size(); ++i) {
-        grad[i] = partial(function_nd, point, i);
-    }
-
-    return grad;
-}
-
-Eigen::MatrixXd hessian(std::function<double(const Eigen::VectorXd)> function_nd, Eigen::VectorXd& point) {
-    Eigen::MatrixXd result(point.size(), point.size());
-
-    for (uint32_t row = 0; row < result.rows(); ++row) {
-        for (uint32_t col = row; col < result.cols(); ++col) {
-            result(col, row) = result(row, col) = partial2(function_nd, point, row, col);
-        }
-    }
-
-    return result;
-}
-
-double distance(const Eigen::VectorXd& left, const Eigen::VectorXd& right) {
-    if (left.size() != right.size()) {
-        throw std::runtime_error("Dimensions of vectors are not equal");
-    }
-
-    return (right - left).norm();
-}
-
-std::ostream& operator<<(std::ostream& stream, const Eigen::VectorXd& vec) {
-    stream << '[' << vec[0];
-    for (int i = 1; i < vec.size(); ++i) {
-        stream << ',' << ' ' << vec[i]; 
-    }
-    stream << ']';
-}
\ No newline at end of file
+#include "impl/numerics.ipp"
+
+#define INSTANTIATE_NUMERICS(Scalar) \
+    template vector_t<Scalar> direction(const vector_t<Scalar>& left, const vector_t<Scalar>& right); \
+    template Scalar partial<Scalar>(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, uint32_t index); \
+    template Scalar partial2<Scalar>(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, uint32_t index1, uint32_t index2); \
+    template vector_t<Scalar> gradient<Scalar>(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point); \
+    template matrix_t<Scalar> hessian<Scalar>(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point); \
+    template matrix_t<Scalar> hessian<Scalar>(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, const std::vector<uint32_t>& coords); \
+    template Scalar partial<Scalar>(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, uint32_t index, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper); \
+    template Scalar partial2<Scalar>(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, uint32_t index1, uint32_t index2, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper); \
+    template vector_t<Scalar> gradient<Scalar>(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper); \
+    template matrix_t<Scalar> hessian<Scalar>(non_deduced_t<function_nd_t<Scalar>> function_nd, vector_t<Scalar>& point, const std::vector<uint32_t>& coords, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper); \
+    template vector_t<Scalar> project(const vector_t<Scalar>& point, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper); \
+    template std::vector<uint32_t> free_coords(const vector_t<Scalar>& point, const vector_t<Scalar>& grad, const vector_t<Scalar>& lower, const vector_t<Scalar>& upper); \
+    template Scalar distance(const vector_t<Scalar>& left, const vector_t<Scalar>& right); \
+    template std::ostream& operator<<(std::ostream& stream, const vector_t<Scalar>& vec);
+
+INSTANTIATE_FOR_SCALARS(INSTANTIATE_NUMERICS)
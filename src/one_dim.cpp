@@ -1,135 +1,11 @@
-#include <functional>
-#include <cmath>
 #include "one_dim.h"
-#include "common.h"
-#include "numerics.h"
-#include "search_result.h"
+#include "impl/one_dim.ipp"
 
-search_result bisect(const std::function<double(double)> function, double left, double right, const double eps, const uint64_t max_iterations) {
-    #ifdef __DEBUG__
-        std::cout << "Called one dimensional bisect method with parameters: left = " << left << "; right = " << right 
-        << "; eps =" << eps << "; max_iterations = " << max_iterations << '\n';
-    #endif
+#define INSTANTIATE_ONE_DIM(Scalar) \
+    template search_result_t<Scalar> bisect<Scalar>(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar> left, non_deduced_t<Scalar> right, const non_deduced_t<Scalar> eps, const uint64_t max_iterations); \
+    template search_result_t<Scalar> golden_ratio<Scalar>(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar> left, non_deduced_t<Scalar> right, const non_deduced_t<Scalar> eps, const uint64_t max_iterations); \
+    template search_result_t<Scalar> fibonacchi<Scalar>(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar> left, non_deduced_t<Scalar> right, const non_deduced_t<Scalar> eps); \
+    template search_result_t<Scalar> bracket<Scalar>(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar>& left, non_deduced_t<Scalar>& right, const non_deduced_t<Scalar> start, const non_deduced_t<Scalar> step, const uint64_t max_iterations); \
+    template search_result_t<Scalar> brent<Scalar>(const non_deduced_t<function_t<Scalar>> function, non_deduced_t<Scalar> left, non_deduced_t<Scalar> right, const non_deduced_t<Scalar> eps, const uint64_t max_iterations);
 
-    search_result statistic;
-    statistic.type = search_method_type::BISECT;
-
-    while (statistic.iterations != max_iterations && (statistic.accuracy = std::abs(right - left)) >= 2 * eps) {
-        #ifdef __DEBUG__
-            std::cout << "Iteration #" << statistic.iterations + 1 << ": left = " << left
-             << "; right = " << right << "; accuracy = " << statistic.accuracy << '\n';
-        #endif
-
-        statistic.result = (left + right) * 0.5;
-        
-        double x_l = statistic.result - eps * 0.1;
-        double x_r = statistic.result + eps * 0.1;
-
-        if (function(x_l) > function(x_r)) {
-            left = x_l;
-        } else {
-            right = x_r;
-        }
-
-        ++statistic.iterations;
-    }
-
-    statistic.function_probes = 2 * statistic.iterations;
-    statistic.accuracy *= 0.5;
-
-    return statistic;
-}
-
-search_result golden_ratio(const std::function<double(double)> function, double left, double right, const double eps, const uint64_t max_iterations) {
-    #ifdef __DEBUG__
-        std::cout << "Called one dimensional golden ratio method with parameters: left = " << left << "; right = " << right 
-        << "; eps =" << eps << "; max_iterations = " << max_iterations << '\n';
-    #endif
-
-    search_result statistic;
-    statistic.type = search_method_type::GOLDEN_RATIO;
-
-    double x_r = left + PSI * (right - left);
-    double x_l = right - PSI * (right - left);
-
-    double y_l = function(x_l);
-    double y_r = function(x_r);
-
-    while (statistic.iterations != max_iterations && (statistic.accuracy = std::abs(right - left)) >= 2 * eps) {
-        #ifdef __DEBUG__
-            std::cout << "Iteration #" << statistic.iterations + 1 << ": left = " << left
-             << "; right = " << right << "; accuracy = " << statistic.accuracy << '\n';
-        #endif
-        if (y_l > y_r) {
-            left = x_l;
-            x_l = x_r;
-            y_l = y_r;
-            x_r = left + PSI * (right - left);
-            y_r = function(x_r);
-        } else {
-            right = x_r;
-            x_r = x_l;
-            y_r = y_l;
-            x_l = right - PSI * (right - left);
-            y_l = function(x_l);
-        }
-
-        ++statistic.iterations;
-    }
-
-    statistic.function_probes = statistic.iterations + 2;
-    statistic.result = (left + right) * 0.5;
-    statistic.accuracy *= 0.5;
-
-    return statistic;
-}
-
-search_result fibonacchi(const std::function<double(double)> function, double left, double right, const double eps) {
-    #ifdef __DEBUG__
-        std::cout << "Called one dimensional fibonacchi method with parameters: left = " << left << "; right = " << right 
-        << "; eps =" << eps << '\n';
-    #endif
-
-    search_result statistic;
-    statistic.type = search_method_type::FIBONACCHI;
-
-    double fib_1 = 1.0, fib_2 = 1.0;
-    double threshold = (right - left) / eps;
-
-    while (fib_2 < threshold) {
-        fib_next(fib_1, fib_2);
-        ++statistic.iterations;
-    }
-
-    double x_r = left + fib_1 * (right - left) / fib_2;
-    double x_l = left + (fib_2 - fib_1) * (right - left) / fib_2;
-
-    double y_r = function(x_r);
-    double y_l = function(x_l);
-    for (uint64_t iterations = statistic.iterations; iterations > 0; --iterations) {
-        #ifdef __DEBUG__
-            std::cout << "Iteration #" << statistic.iterations - iterations + 1 << ": left = " << left
-             << "; right = " << right << "; accuracy = " << std::abs(right - left) / 2 << '\n';
-        #endif
-        fib_prev(fib_1, fib_2);
-        if (y_l > y_r) {
-            left = x_l;
-            x_l = x_r;
-            y_l = y_r;
-            x_r = left + fib_1 * (right - left) / fib_2;
-            y_r = function(x_r);
-        } else {
-            right = x_r;
-            x_r = x_l;
-            y_r = y_l;
-            x_l = left + (fib_2 - fib_1) * (right - left) / fib_2;
-            y_l = function(x_l);
-        }
-    }
-
-    statistic.result = (left + right) * 0.5;
-    statistic.accuracy = std::abs(right - left) * 0.5;
-    statistic.function_probes = statistic.iterations + 2;
-
-    return statistic;
-}
\ No newline at end of file
+INSTANTIATE_FOR_SCALARS(INSTANTIATE_ONE_DIM)
@@ -1,10 +1,7 @@
 #include "search_result.h"
-#include "common.h"
+#include "impl/search_result.ipp"
 
-std::ostream& operator<<(std::ostream& stream, const search_result& statistic) {
-    return stream << "Search result = {Search method: " << (search_method_string.begin())[statistic.type] << "; " 
-    << "Extremum of function: " << statistic.result << "; " 
-    << "Accuracy: " << statistic.accuracy << "; " 
-    << "Iterations: " << statistic.iterations << "; " 
-    << "Function probes: " << statistic.function_probes << "}\n";
-}
\ No newline at end of file
+#define INSTANTIATE_SEARCH_RESULT(Scalar) \
+    template std::ostream& operator<<(std::ostream& stream, const search_result_t<Scalar>& statistic);
+
+INSTANTIATE_FOR_SCALARS(INSTANTIATE_SEARCH_RESULT)
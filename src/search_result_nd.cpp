@@ -1,13 +1,7 @@
 #include "search_result_nd.h"
-#include "common.h"
-#include "numerics.h"
+#include "impl/search_result_nd.ipp"
 
-std::ostream& operator<<(std::ostream& stream, const search_result_nd& statistic) {
-    stream << "Search result = {Search method: " << (search_method_string_nd.begin())[statistic.type] << "; " 
-    << "Extremum of function: " << statistic.result << "; " 
-    << "Accuracy: " << statistic.accuracy << "; " 
-    << "Iterations: " << statistic.iterations << "; " 
-    << "Function probes: " << statistic.function_probes << "}\n";
+#define INSTANTIATE_SEARCH_RESULT_ND(Scalar) \
+    template std::ostream& operator<<(std::ostream& stream, const search_result_nd_t<Scalar>& statistic);
 
-    return stream;
-}
\ No newline at end of file
+INSTANTIATE_FOR_SCALARS(INSTANTIATE_SEARCH_RESULT_ND)
@@ -0,0 +1,7 @@
+#include "solver_session.h"
+#include "impl/solver_session.ipp"
+
+#define INSTANTIATE_SOLVER_SESSION(Scalar) \
+    template class solver_session_t<Scalar>;
+
+INSTANTIATE_FOR_SCALARS(INSTANTIATE_SOLVER_SESSION)
@@ -0,0 +1,10 @@
+#include "stochastic.h"
+#include "impl/stochastic.ipp"
+
+#define INSTANTIATE_STOCHASTIC(Scalar) \
+    template struct sum_objective_t<Scalar>; \
+    template search_result_nd_t<Scalar> sgd_momentum(const sum_objective_t<Scalar>& objective, const vector_t<Scalar>& start, const non_deduced_t<Scalar> learning_rate, const non_deduced_t<Scalar> momentum, const uint64_t batch_size, const uint64_t epochs, const non_deduced_t<Scalar> eps); \
+    template search_result_nd_t<Scalar> adam(const sum_objective_t<Scalar>& objective, const vector_t<Scalar>& start, const non_deduced_t<Scalar> learning_rate, const uint64_t batch_size, const uint64_t epochs, const non_deduced_t<Scalar> eps); \
+    template search_result_nd_t<Scalar> svrg(const sum_objective_t<Scalar>& objective, const vector_t<Scalar>& start, const non_deduced_t<Scalar> learning_rate, const uint64_t batch_size, const uint64_t epochs, const non_deduced_t<Scalar> eps);
+
+INSTANTIATE_FOR_SCALARS(INSTANTIATE_STOCHASTIC)